@@ -1 +1,12 @@
-#include "LayerImageAsset.h"
\ No newline at end of file
+#include "LayerImageAsset.h"
+
+#if WITH_EDITOR
+ULayerImageAsset::FOnLayerImageAssetChanged ULayerImageAsset::OnLayerImageAssetChanged;
+
+void ULayerImageAsset::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+    Super::PostEditChangeProperty(PropertyChangedEvent);
+
+    OnLayerImageAssetChanged.Broadcast(this);
+}
+#endif
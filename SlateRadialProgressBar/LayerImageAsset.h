@@ -1,5 +1,6 @@
 #pragma once
 
+#include "RadialProgressBarTypes.h"
 #include "LayerImageAsset.generated.h"
 
 
@@ -15,4 +16,17 @@ public:
     UPROPERTY(EditDefaultsOnly)
     TArray<FSlateBrush> Layers; 
 
+    /** Ring each layer is drawn on, matched to Layers by index. Layers without an entry are drawn on the default ring. */
+    UPROPERTY(EditDefaultsOnly)
+    TArray<FRadialLayerRing> LayerRings;
+
+#if WITH_EDITOR
+    DECLARE_MULTICAST_DELEGATE_OneParam(FOnLayerImageAssetChanged, const ULayerImageAsset*);
+
+    /** Broadcast when the layers of a layer asset are edited, so widgets drawing it can resolve them again */
+    static FOnLayerImageAssetChanged OnLayerImageAssetChanged;
+
+    virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+#endif
+
 };
\ No newline at end of file
@@ -0,0 +1,87 @@
+#include "RadialArcIndexBuffers.h"
+#include "RadialMeshGenerator.h"
+#include "Misc/ScopeLock.h"
+#include <atomic>
+
+namespace RadialProgressBar
+{
+	namespace ArcIndexBuffers
+	{
+		static std::atomic<const TArray<SlateIndex>*> Buffers[RadialMesh::MaxPairCount + 1];
+		static FCriticalSection BuildLock;
+
+		static TMap<TPair<int32, int32>, TUniquePtr<TArray<SlateIndex>>> SegmentedBuffers;
+		static TMap<TPair<int32, int32>, TUniquePtr<TArray<SlateIndex>>> RoundCappedBuffers;
+	}
+
+	const TArray<SlateIndex>& GetSharedArcIndices(int32 NumPairs)
+	{
+		using namespace ArcIndexBuffers;
+
+		NumPairs = FMath::Clamp(NumPairs, 0, RadialMesh::MaxPairCount);
+
+		const TArray<SlateIndex>* Buffer = Buffers[NumPairs].load(std::memory_order_acquire);
+		if (!Buffer)
+		{
+			FScopeLock Lock(&BuildLock);
+			Buffer = Buffers[NumPairs].load(std::memory_order_relaxed);
+			if (!Buffer)
+			{
+				TArray<SlateIndex>* NewBuffer = new TArray<SlateIndex>();
+				NewBuffer->Append(RadialMesh::GetArcIndexTable<SlateIndex>(), FMath::Max(NumPairs - 1, 0) * 6);
+				Buffer = NewBuffer;
+				Buffers[NumPairs].store(Buffer, std::memory_order_release);
+			}
+		}
+		return *Buffer;
+	}
+
+	const TArray<SlateIndex>& GetSharedSegmentedArcIndices(int32 PairsPerSegment, int32 NumSegments)
+	{
+		using namespace ArcIndexBuffers;
+
+		PairsPerSegment = FMath::Clamp(PairsPerSegment, 0, RadialMesh::MaxPairCount);
+		NumSegments = FMath::Max(NumSegments, 0);
+
+		FScopeLock Lock(&BuildLock);
+
+		TUniquePtr<TArray<SlateIndex>>& Buffer = SegmentedBuffers.FindOrAdd(TPair<int32, int32>(PairsPerSegment, NumSegments));
+		if (!Buffer.IsValid())
+		{
+			const int32 IndicesPerSegment = FMath::Max(PairsPerSegment - 1, 0) * 6;
+
+			Buffer = MakeUnique<TArray<SlateIndex>>();
+			Buffer->SetNumUninitialized(IndicesPerSegment * NumSegments);
+			for (int32 SegmentIndex = 0; SegmentIndex < NumSegments; ++SegmentIndex)
+			{
+				RadialMesh::GenerateArcIndices<SlateIndex>(PairsPerSegment, (SlateIndex)(SegmentIndex * PairsPerSegment * 2), Buffer->GetData() + SegmentIndex * IndicesPerSegment);
+			}
+		}
+		return *Buffer;
+	}
+
+	const TArray<SlateIndex>& GetSharedRoundCappedArcIndices(int32 NumPairs, int32 NumCapPoints)
+	{
+		using namespace ArcIndexBuffers;
+
+		NumPairs = FMath::Clamp(NumPairs, 0, RadialMesh::MaxPairCount);
+		NumCapPoints = FMath::Clamp(NumCapPoints, 0, RadialMesh::MaxRoundCapPointCount);
+
+		FScopeLock Lock(&BuildLock);
+
+		TUniquePtr<TArray<SlateIndex>>& Buffer = RoundCappedBuffers.FindOrAdd(TPair<int32, int32>(NumPairs, NumCapPoints));
+		if (!Buffer.IsValid())
+		{
+			const int32 NumArcIndices = FMath::Max(NumPairs - 1, 0) * 6;
+			const int32 NumCapIndices = FMath::Max(NumCapPoints - 2, 0) * 3;
+
+			// The caps follow the arc pairs, the start cap first
+			Buffer = MakeUnique<TArray<SlateIndex>>();
+			Buffer->SetNumUninitialized(NumArcIndices + NumCapIndices * 2);
+			RadialMesh::GenerateArcIndices<SlateIndex>(NumPairs, 0, Buffer->GetData());
+			RadialMesh::GenerateRoundCapIndices<SlateIndex>(NumCapPoints, (SlateIndex)(NumPairs * 2), Buffer->GetData() + NumArcIndices);
+			RadialMesh::GenerateRoundCapIndices<SlateIndex>(NumCapPoints, (SlateIndex)(NumPairs * 2 + NumCapPoints), Buffer->GetData() + NumArcIndices + NumCapIndices);
+		}
+		return *Buffer;
+	}
+}
@@ -0,0 +1,29 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Rendering/RenderingCommon.h"
+
+namespace RadialProgressBar
+{
+	/**
+	 * Returns the shared, immutable triangle list joining NumPairs vertex pairs laid out by RadialMesh::GenerateArcDirections.
+	 * Each list is copied once from the prefix of RadialMesh::GetArcIndexTable the first time its pair count is needed, and
+	 * never freed, so widgets can submit it directly instead of generating and storing their own indices.
+	 *
+	 * @param	NumPairs	Number of vertex pairs, clamped to [0, RadialMesh::MaxPairCount]
+	 */
+	TANKMAYHEM_API const TArray<SlateIndex>& GetSharedArcIndices(int32 NumPairs);
+
+	/**
+	 * Returns the shared, immutable triangle list of NumSegments separate arcs of PairsPerSegment vertex pairs each, laid out
+	 * one after the other. Lists are built once per combination and never freed. Looking one up takes a lock, so widgets
+	 * should only do it when their number of filled segments changes.
+	 */
+	TANKMAYHEM_API const TArray<SlateIndex>& GetSharedSegmentedArcIndices(int32 PairsPerSegment, int32 NumSegments);
+
+	/**
+	 * Returns the shared, immutable triangle list of an arc of NumPairs vertex pairs followed by its two rounded caps of
+	 * NumCapPoints points each, see RadialMesh::GenerateRoundCap. Built and looked up like GetSharedSegmentedArcIndices.
+	 */
+	TANKMAYHEM_API const TArray<SlateIndex>& GetSharedRoundCappedArcIndices(int32 NumPairs, int32 NumCapPoints);
+}
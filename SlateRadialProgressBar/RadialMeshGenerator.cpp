@@ -0,0 +1,176 @@
+#include "RadialMeshGenerator.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <mutex>
+
+namespace RadialMesh
+{
+	namespace
+	{
+		constexpr double TwoPi = 6.28318530717958647692;
+
+		std::atomic<const FPoint*> UnitCircles[MaxResolution + 1];
+		std::mutex UnitCircleBuildMutex;
+
+		int32_t ClampResolution(int32_t Resolution)
+		{
+			return std::min(std::max(Resolution, MinResolution), MaxResolution);
+		}
+
+		const FPoint* BuildUnitCircle(int32_t Resolution)
+		{
+			FPoint* Table = new FPoint[Resolution + 1];
+			for (int32_t i = 0; i < Resolution; ++i)
+			{
+				const double Angle = i / (double)Resolution * TwoPi;
+				Table[i] = { (float)std::cos(Angle), (float)std::sin(Angle) };
+			}
+			Table[Resolution] = Table[0];
+			return Table;
+		}
+
+		FPoint Normalize(FPoint Point)
+		{
+			const float Length = std::sqrt(Point.X * Point.X + Point.Y * Point.Y);
+			return Length > 0.0f ? FPoint{ Point.X / Length, Point.Y / Length } : FPoint{ 1.0f, 0.0f };
+		}
+	}
+
+	const FPoint* GetUnitCircle(int32_t Resolution)
+	{
+		Resolution = ClampResolution(Resolution);
+
+		const FPoint* Table = UnitCircles[Resolution].load(std::memory_order_acquire);
+		if (!Table)
+		{
+			std::lock_guard<std::mutex> Lock(UnitCircleBuildMutex);
+			Table = UnitCircles[Resolution].load(std::memory_order_relaxed);
+			if (!Table)
+			{
+				Table = BuildUnitCircle(Resolution);
+				UnitCircles[Resolution].store(Table, std::memory_order_release);
+			}
+		}
+		return Table;
+	}
+
+	FPoint GetUnitDirection(const FPoint* UnitCircle, int32_t Resolution, float Fraction)
+	{
+		const float Segment = std::min(std::max(Fraction, 0.0f), 1.0f) * Resolution;
+		const int32_t Index = std::min((int32_t)Segment, Resolution - 1);
+		const float Alpha = Segment - Index;
+
+		const FPoint& From = UnitCircle[Index];
+		const FPoint& To = UnitCircle[Index + 1];
+		if (Alpha <= 0.0f)
+		{
+			return From;
+		}
+		if (Alpha >= 1.0f)
+		{
+			return To;
+		}
+		return Normalize({ From.X + (To.X - From.X) * Alpha, From.Y + (To.Y - From.Y) * Alpha });
+	}
+
+	int32_t GenerateArcDirections(const FArcParams& Params, FPoint* OutDirections)
+	{
+		const float Sweep = std::min(std::abs(Params.SweepFraction), 1.0f);
+		if (Sweep <= 0.0f)
+		{
+			return 0;
+		}
+
+		const int32_t Resolution = ClampResolution(Params.Resolution);
+		const FPoint* UnitCircle = GetUnitCircle(Resolution);
+		const FPoint* FineUnitCircle = GetUnitCircle(MaxResolution);
+
+		// Rotate the table to the start angle and mirror it for counter-clockwise sweeps, both without trig
+		const float StartFraction = Params.StartFraction - std::floor(Params.StartFraction);
+		const FPoint Rotation = GetUnitDirection(FineUnitCircle, MaxResolution, StartFraction);
+		const float Mirror = Params.SweepFraction < 0.0f ? -1.0f : 1.0f;
+
+		int32_t NumDirections = 0;
+		const auto AddDirection = [&](FPoint Direction)
+		{
+			OutDirections[NumDirections++] =
+			{
+				Direction.X * Rotation.X - Direction.Y * Mirror * Rotation.Y,
+				Direction.X * Rotation.Y + Direction.Y * Mirror * Rotation.X
+			};
+		};
+
+		const float CoveredSegments = Sweep * Resolution;
+		const int32_t NumFullSegments = std::min((int32_t)CoveredSegments, Resolution);
+		for (int32_t i = 0; i <= NumFullSegments; ++i)
+		{
+			AddDirection(UnitCircle[i]);
+		}
+
+		// End cap at the exact end of the sweep, unless it already landed on a segment boundary. It is taken from the finest
+		// table like the rotation, interpolating between the boundaries of a coarse ring would bend it by up to several degrees.
+		if (CoveredSegments > (float)NumFullSegments)
+		{
+			AddDirection(GetUnitDirection(FineUnitCircle, MaxResolution, Sweep));
+		}
+
+		return NumDirections;
+	}
+
+	int32_t GenerateRoundCap(const FArcParams& Params, bool bEndCap, FPoint* OutPoints)
+	{
+		const float Sweep = std::min(std::abs(Params.SweepFraction), 1.0f);
+		if (Sweep <= 0.0f || Sweep >= 1.0f)
+		{
+			return 0;
+		}
+
+		const int32_t Resolution = ClampResolution(Params.Resolution);
+		const int32_t CapSegments = GetRoundCapSegments(Resolution);
+
+		// The first half of the table of twice the cap's segments is a half circle, rotated onto the end of the arc below
+		const FPoint* HalfCircle = GetUnitCircle(CapSegments * 2);
+
+		const float Mirror = Params.SweepFraction < 0.0f ? -1.0f : 1.0f;
+		const float EndFraction = Params.StartFraction + (bEndCap ? Sweep * Mirror : 0.0f);
+		const FPoint Direction = GetUnitDirection(GetUnitCircle(MaxResolution), MaxResolution, EndFraction - std::floor(EndFraction));
+
+		// The cap bulges forwards along the sweep at its end, and backwards at its start
+		const float Bulge = bEndCap ? Mirror : -Mirror;
+		const FPoint Tangent = { -Direction.Y * Bulge, Direction.X * Bulge };
+
+		const float HalfWidth = (Params.RadiusOuter - Params.RadiusInner) * 0.5f;
+		const float MidRadius = Params.RadiusInner + HalfWidth;
+		const FPoint Centre = { Params.CenterX + Direction.X * MidRadius, Params.CenterY + Direction.Y * MidRadius };
+
+		OutPoints[0] = Centre;
+		for (int32_t RimIndex = 0; RimIndex <= CapSegments; ++RimIndex)
+		{
+			const FPoint& Rim = HalfCircle[RimIndex];
+			OutPoints[RimIndex + 1] =
+			{
+				Centre.X + (Direction.X * Rim.X + Tangent.X * Rim.Y) * HalfWidth,
+				Centre.Y + (Direction.Y * Rim.X + Tangent.Y * Rim.Y) * HalfWidth
+			};
+		}
+
+		return CapSegments + 2;
+	}
+
+	int32_t GenerateArcPositions(const FArcParams& Params, FPoint* OutPairs)
+	{
+		FPoint Directions[MaxPairCount];
+		const int32_t NumPairs = GenerateArcDirections(Params, Directions);
+
+		for (int32_t PairIndex = 0; PairIndex < NumPairs; ++PairIndex)
+		{
+			const FPoint& Direction = Directions[PairIndex];
+			OutPairs[PairIndex * 2 + 0] = { Params.CenterX + Direction.X * Params.RadiusInner, Params.CenterY + Direction.Y * Params.RadiusInner };
+			OutPairs[PairIndex * 2 + 1] = { Params.CenterX + Direction.X * Params.RadiusOuter, Params.CenterY + Direction.Y * Params.RadiusOuter };
+		}
+
+		return NumPairs;
+	}
+}
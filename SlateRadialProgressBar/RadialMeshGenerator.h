@@ -0,0 +1,158 @@
+#pragma once
+
+// Ring and arc tessellation shared by the radial progress widgets.
+// This file deliberately depends on nothing but the C++ standard library, so the geometry can be built, tested and
+// profiled without the engine, a renderer or an editor. The widgets convert its plain output into FSlateVertex.
+
+#include <cstdint>
+
+namespace RadialMesh
+{
+	/** Range of resolutions a ring can be tessellated with */
+	constexpr int32_t MinResolution = 3;
+	constexpr int32_t MaxResolution = 256;
+
+	/** Largest number of (inner, outer) vertex pairs an arc of the given resolution can produce: every segment boundary plus the end cap */
+	constexpr int32_t GetMaxPairCount(int32_t Resolution) { return Resolution + 2; }
+
+	/** Largest number of vertex pairs an arc of any resolution can produce */
+	constexpr int32_t MaxPairCount = GetMaxPairCount(MaxResolution);
+
+	/** Number of segments of the half circle of a rounded cap, for a ring of the given resolution */
+	constexpr int32_t GetRoundCapSegments(int32_t Resolution) { return Resolution / 4 > 2 ? Resolution / 4 : 2; }
+
+	/** Number of points of a rounded cap of the given resolution: its centre followed by every point of its rim */
+	constexpr int32_t GetRoundCapPointCount(int32_t Resolution) { return GetRoundCapSegments(Resolution) + 2; }
+
+	/** Largest number of points a rounded cap of any resolution can produce */
+	constexpr int32_t MaxRoundCapPointCount = GetRoundCapPointCount(MaxResolution);
+
+	/** Plain 2D position */
+	struct FPoint
+	{
+		float X;
+		float Y;
+	};
+
+	/** Describes the covered part of a ring */
+	struct FArcParams
+	{
+		/** Centre of the ring */
+		float CenterX = 0.0f;
+		float CenterY = 0.0f;
+
+		/** Distance from the centre to the inner and outer edge of the ring */
+		float RadiusInner = 0.0f;
+		float RadiusOuter = 0.0f;
+
+		/** Angle the arc starts at, as a fraction of a full turn clockwise from +X in Slate space */
+		float StartFraction = 0.0f;
+
+		/** Covered fraction of the ring in [-1, 1], negative values sweep counter-clockwise */
+		float SweepFraction = 1.0f;
+
+		/** Number of segments of a full ring, clamped to [MinResolution, MaxResolution] */
+		int32_t Resolution = 16;
+	};
+
+	/**
+	 * Returns the directions (cos, sin) of Resolution evenly spaced angles, clockwise from +X in Slate space.
+	 * The table is built once per resolution, shared process-wide, and holds Resolution + 1 entries, the last repeating the first.
+	 */
+	const FPoint* GetUnitCircle(int32_t Resolution);
+
+	/** Direction at an arbitrary fraction [0, 1] of a turn, interpolated from a unit circle table without any trig. */
+	FPoint GetUnitDirection(const FPoint* UnitCircle, int32_t Resolution, float Fraction);
+
+	/**
+	 * Writes the unit direction of every vertex pair of the covered arc: one per covered segment boundary, followed by the
+	 * exact end of the sweep when it does not land on a boundary. A full sweep closes the ring on its first direction,
+	 * an empty sweep produces nothing. The centre and radii of Params are ignored.
+	 *
+	 * @param	Params			The arc to tessellate
+	 * @param	OutDirections	Receives GetMaxPairCount(Resolution) directions at most
+	 * @return	the number of directions written
+	 */
+	int32_t GenerateArcDirections(const FArcParams& Params, FPoint* OutDirections);
+
+	/**
+	 * Writes the covered arc as interleaved (inner, outer) positions: one pair per covered segment boundary, followed by the
+	 * pair at the exact end of the sweep when it does not land on a boundary. A full sweep closes the ring on its first pair,
+	 * an empty sweep produces nothing.
+	 *
+	 * @param	Params		The arc to tessellate
+	 * @param	OutPairs	Receives 2 * GetMaxPairCount(Resolution) positions at most
+	 * @return	the number of pairs written
+	 */
+	int32_t GenerateArcPositions(const FArcParams& Params, FPoint* OutPairs);
+
+	/**
+	 * Writes the half circle rounding off one end of the covered arc, bulging out of the arc: the centre of the half circle,
+	 * followed by its rim from the outer edge of the ring to the inner edge. The rim is taken from the shared unit circle
+	 * table of twice its number of segments. Empty and full sweeps have no ends and produce nothing.
+	 *
+	 * @param	Params		The arc to cap
+	 * @param	bEndCap		Caps the end of the sweep when set, its start otherwise
+	 * @param	OutPoints	Receives GetRoundCapPointCount(Resolution) points at most
+	 * @return	the number of points written
+	 */
+	int32_t GenerateRoundCap(const FArcParams& Params, bool bEndCap, FPoint* OutPoints);
+
+	/** Largest number of indices an arc of any resolution can produce */
+	constexpr int32_t MaxIndexCount = (MaxPairCount - 1) * 6;
+
+	/**
+	 * Writes the triangle list joining NumPairs consecutive vertex pairs laid out as by GenerateArcPositions.
+	 * Every quad is (inner, outer, next inner), (outer, next outer, next inner).
+	 *
+	 * @param	NumPairs	Number of vertex pairs, produces (NumPairs - 1) * 6 indices
+	 * @param	BaseVertex	Index of the first inner vertex
+	 * @param	OutIndices	Receives the indices
+	 */
+	template<typename IndexType>
+	void GenerateArcIndices(int32_t NumPairs, IndexType BaseVertex, IndexType* OutIndices)
+	{
+		for (int32_t QuadIndex = 0; QuadIndex < NumPairs - 1; ++QuadIndex)
+		{
+			const IndexType BottomLeftIndex = BaseVertex + (IndexType)(QuadIndex * 2);
+			const IndexType TopLeftIndex = BottomLeftIndex + 1;
+			const IndexType BottomRightIndex = BottomLeftIndex + 2;
+			const IndexType TopRightIndex = BottomLeftIndex + 3;
+
+			*OutIndices++ = BottomLeftIndex; *OutIndices++ = TopLeftIndex; *OutIndices++ = BottomRightIndex;
+			*OutIndices++ = TopLeftIndex; *OutIndices++ = TopRightIndex; *OutIndices++ = BottomRightIndex;
+		}
+	}
+
+	/**
+	 * Writes the triangle fan of a rounded cap laid out as by GenerateRoundCap.
+	 *
+	 * @param	NumPoints	Number of points of the cap, produces (NumPoints - 2) * 3 indices
+	 * @param	BaseVertex	Index of the centre of the cap
+	 * @param	OutIndices	Receives the indices
+	 */
+	template<typename IndexType>
+	void GenerateRoundCapIndices(int32_t NumPoints, IndexType BaseVertex, IndexType* OutIndices)
+	{
+		for (int32_t RimIndex = 1; RimIndex < NumPoints - 1; ++RimIndex)
+		{
+			*OutIndices++ = BaseVertex; *OutIndices++ = BaseVertex + (IndexType)RimIndex; *OutIndices++ = BaseVertex + (IndexType)(RimIndex + 1);
+		}
+	}
+
+	/**
+	 * Returns the immutable triangle list joining MaxPairCount vertex pairs, built once and shared process-wide.
+	 * Any arc's indices are a prefix of it: (NumPairs - 1) * 6 indices for NumPairs pairs, whatever the resolution.
+	 */
+	template<typename IndexType>
+	const IndexType* GetArcIndexTable()
+	{
+		struct FTable
+		{
+			IndexType Indices[MaxIndexCount];
+			FTable() { GenerateArcIndices<IndexType>(MaxPairCount, 0, Indices); }
+		};
+		static const FTable Table;
+		return Table.Indices;
+	}
+}
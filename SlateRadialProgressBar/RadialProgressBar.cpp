@@ -39,7 +39,20 @@ TSharedRef<SWidget> URadialProgressBar::RebuildWidget()
 			.FlipForRightToLeftFlowDirection(bFlipForRightToLeftFlowDirection)
 			.LayerImageAssetClass(LayerImageAssetClass)
 			.ProgressPercentage(ProgressPercentage)
-			.BarTexture(BarTexture);
+			.BarTexture(BarTexture)
+			.BatchLayers(bBatchLayers)
+			.RenderMode(RenderMode)
+			.ProgressChangeThreshold(ProgressChangeThreshold)
+			.Resolution(Resolution)
+			.AdaptiveResolution(bAdaptiveResolution)
+			.MinResolution(MinResolution)
+			.MaxResolution(MaxResolution)
+			.MaxChordError(MaxChordError)
+			.Segments(Segments)
+			.SegmentGapAngle(SegmentGapAngle)
+			.RoundCaps(bRoundCaps)
+			.SharedMaterial(bSharedMaterial)
+			.OnProgressAnimationFinished(BIND_UOBJECT_DELEGATE(FSimpleDelegate, HandleProgressAnimationFinished));
 
 	return MyImage.ToSharedRef();
 }
@@ -54,9 +67,25 @@ void URadialProgressBar::SynchronizeProperties()
 
 	if (MyImage.IsValid())
 	{
+		// The dynamic material replaces the Brush resource first, so the image binding pushed next is the one the widget keeps
+		EnsureMaterialRenderModeInstance();
 		MyImage->SetImage(ImageBinding);
 		MyImage->SetColorAndOpacity(ColorAndOpacityBinding);
+		MyImage->SetLayerImageAssetClass(LayerImageAssetClass);
+		MyImage->SetBarTexture(BarTexture);
+		MyImage->SetBatchLayers(bBatchLayers);
+		MyImage->SetRenderMode(RenderMode);
+		MyImage->SetProgressChangeThreshold(ProgressChangeThreshold);
+		MyImage->SetResolution(Resolution);
+		MyImage->SetAdaptiveResolution(bAdaptiveResolution, MinResolution, MaxResolution, MaxChordError);
+		MyImage->SetSegments(Segments, SegmentGapAngle);
+		MyImage->SetRoundCaps(bRoundCaps);
+		MyImage->SetSharedMaterial(bSharedMaterial);
 		MyImage->SetProgressPercentage(ProgressPercentageBinding);
+		for (int32 ProgressSource = 1; ProgressSource < LayerProgress.Num(); ++ProgressSource)
+		{
+			MyImage->SetLayerProgress(ProgressSource, LayerProgress[ProgressSource]);
+		}
 		MyImage->SetOnMouseButtonDown(BIND_UOBJECT_DELEGATE(FPointerEventHandler, HandleMouseButtonDown));
 	}
 }
@@ -79,6 +108,164 @@ void URadialProgressBar::SetProgressPercentage(float InProgressPercentage)
 	}
 }
 
+void URadialProgressBar::AnimateProgressTo(float TargetPercentage, float Duration, ERadialProgressEasing Easing)
+{
+	// The UMG value holds the target, so a rebuilt widget lands where the transition would have ended
+	ProgressPercentage = TargetPercentage;
+	if ( MyImage.IsValid() )
+	{
+		MyImage->AnimateProgressTo(TargetPercentage, Duration, Easing);
+	}
+	else
+	{
+		OnProgressAnimationFinished.Broadcast();
+	}
+}
+
+void URadialProgressBar::StopProgressAnimation()
+{
+	if ( MyImage.IsValid() )
+	{
+		MyImage->StopProgressAnimation();
+		ProgressPercentage = MyImage->GetLayerProgress(0);
+	}
+}
+
+void URadialProgressBar::SetLayerProgress(int32 ProgressSource, float InProgressPercentage)
+{
+	if (ProgressSource == 0)
+	{
+		SetProgressPercentage(InProgressPercentage);
+		return;
+	}
+
+	// The index comes straight from Blueprint, a bad one must not size the array
+	if (ProgressSource > 0 && ProgressSource < SRadialProgressBar::MaxProgressSources)
+	{
+		if (LayerProgress.Num() <= ProgressSource)
+		{
+			LayerProgress.SetNumZeroed(ProgressSource + 1);
+		}
+		LayerProgress[ProgressSource] = InProgressPercentage;
+
+		if ( MyImage.IsValid() )
+		{
+			MyImage->SetLayerProgress(ProgressSource, InProgressPercentage);
+		}
+	}
+}
+
+void URadialProgressBar::SetRenderMode(ERadialProgressBarRenderMode InRenderMode)
+{
+	RenderMode = InRenderMode;
+	if ( MyImage.IsValid() )
+	{
+		MyImage->SetRenderMode(RenderMode);
+		EnsureMaterialRenderModeInstance();
+	}
+}
+
+void URadialProgressBar::EnsureMaterialRenderModeInstance()
+{
+	// The Material render mode hands the ring to a dynamic instance of the Brush material, unless it is shared and the ring
+	// travels in the vertices. Designer previews keep the material as it is, so no transient instance ends up saved in the Brush.
+	// A bound BrushDelegate supplies the brush itself, pushing the Brush would drop the binding.
+	if ( RenderMode == ERadialProgressBarRenderMode::Material && !bSharedMaterial && !IsDesignTime() && !BrushDelegate.IsBound() )
+	{
+		GetDynamicMaterial();
+	}
+}
+
+void URadialProgressBar::SetProgressChangeThreshold(float InProgressChangeThreshold)
+{
+	ProgressChangeThreshold = InProgressChangeThreshold;
+	if ( MyImage.IsValid() )
+	{
+		MyImage->SetProgressChangeThreshold(ProgressChangeThreshold);
+	}
+}
+
+void URadialProgressBar::SetResolution(int32 InResolution)
+{
+	Resolution = InResolution;
+	if ( MyImage.IsValid() )
+	{
+		MyImage->SetResolution(Resolution);
+	}
+}
+
+void URadialProgressBar::SetAdaptiveResolution(bool bInAdaptiveResolution, int32 InMinResolution, int32 InMaxResolution, float InMaxChordError)
+{
+	bAdaptiveResolution = bInAdaptiveResolution;
+	MinResolution = InMinResolution;
+	MaxResolution = InMaxResolution;
+	MaxChordError = InMaxChordError;
+	if ( MyImage.IsValid() )
+	{
+		MyImage->SetAdaptiveResolution(bAdaptiveResolution, MinResolution, MaxResolution, MaxChordError);
+	}
+}
+
+void URadialProgressBar::SetSegments(int32 InSegments, float InSegmentGapAngle)
+{
+	Segments = InSegments;
+	SegmentGapAngle = InSegmentGapAngle;
+	if ( MyImage.IsValid() )
+	{
+		MyImage->SetSegments(Segments, SegmentGapAngle);
+	}
+}
+
+void URadialProgressBar::SetRoundCaps(bool bInRoundCaps)
+{
+	bRoundCaps = bInRoundCaps;
+	if ( MyImage.IsValid() )
+	{
+		MyImage->SetRoundCaps(bRoundCaps);
+	}
+}
+
+void URadialProgressBar::SetSharedMaterial(bool bInSharedMaterial)
+{
+	bSharedMaterial = bInSharedMaterial;
+	if ( MyImage.IsValid() )
+	{
+		MyImage->SetSharedMaterial(bSharedMaterial);
+		EnsureMaterialRenderModeInstance();
+	}
+}
+
+void URadialProgressBar::SetFilledSegments(int32 InFilledSegments)
+{
+	const int32 SegmentCount = FMath::Max(Segments, 1);
+	ProgressPercentage = FMath::Clamp(InFilledSegments, 0, SegmentCount) * 100.0f / SegmentCount;
+	if ( MyImage.IsValid() )
+	{
+		MyImage->SetFilledSegments(InFilledSegments);
+	}
+}
+
+void URadialProgressBar::SetBarTexture(UTexture2D* InBarTexture)
+{
+	CancelBarTextureStreaming();
+
+	if (BarTexture != InBarTexture)
+	{
+		BarTexture = InBarTexture;
+
+		if (BarTexture) // Since this texture is used as UI, don't allow it affected by budget.
+		{
+			BarTexture->bForceMiplevelsToBeResident = true;
+			BarTexture->bIgnoreStreamingMipBias = true;
+		}
+
+		if ( MyImage.IsValid() )
+		{
+			MyImage->SetBarTexture(BarTexture);
+		}
+	}
+}
+
 void URadialProgressBar::SetOpacity(float InOpacity)
 {
 	ColorAndOpacity.A = InOpacity;
@@ -255,6 +442,7 @@ void URadialProgressBar::SetBrushFromMaterial(UMaterialInterface* Material)
 		if (MyImage.IsValid())
 		{
 			MyImage->SetImage(&Brush);
+			EnsureMaterialRenderModeInstance();
 		}
 	}
 }
@@ -270,6 +458,17 @@ void URadialProgressBar::CancelImageStreaming()
 	StreamingObjectPath.Reset();
 }
 
+void URadialProgressBar::CancelBarTextureStreaming()
+{
+	if (BarTextureStreamingHandle.IsValid())
+	{
+		BarTextureStreamingHandle->CancelHandle();
+		BarTextureStreamingHandle.Reset();
+	}
+
+	BarTextureStreamingObjectPath.Reset();
+}
+
 void URadialProgressBar::RequestAsyncLoad(TSoftObjectPtr<UObject> SoftObject, TFunction<void()>&& Callback)
 {
 	RequestAsyncLoad(SoftObject, FStreamableDelegate::CreateLambda(MoveTemp(Callback)));
@@ -336,6 +535,46 @@ void URadialProgressBar::SetBrushFromSoftTexture(TSoftObjectPtr<UTexture2D> Soft
 	);
 }
 
+void URadialProgressBar::SetBarTextureFromSoftTexture(TSoftObjectPtr<UTexture2D> SoftTexture)
+{
+	CancelBarTextureStreaming();
+
+	if (UTexture2D* StrongTexture = SoftTexture.Get())
+	{
+		SetBarTexture(StrongTexture);
+		return;  // No streaming was needed, complete immediately.
+	}
+
+	TWeakObjectPtr<URadialProgressBar> WeakThis(this); // using weak ptr in case 'this' has gone out of scope by the time this lambda is called
+	BarTextureStreamingObjectPath = SoftTexture.ToSoftObjectPath();
+	BarTextureStreamingHandle = UAssetManager::GetStreamableManager().RequestAsyncLoad(
+		BarTextureStreamingObjectPath,
+		[WeakThis, SoftTexture]() {
+			if (URadialProgressBar* StrongThis = WeakThis.Get())
+			{
+				// If the object paths don't match, then this delegate was interrupted, but had already been queued for a callback
+				// so ignore everything and abort.
+				if (StrongThis->BarTextureStreamingObjectPath != SoftTexture.ToSoftObjectPath())
+				{
+					return; // Abort!
+				}
+
+				ensureMsgf(SoftTexture.Get(), TEXT("Failed to load %s"), *SoftTexture.ToSoftObjectPath().ToString());
+				StrongThis->SetBarTexture(SoftTexture.Get());
+			}
+		},
+		FStreamableManager::AsyncLoadHighPriority);
+}
+
+void URadialProgressBar::SetBatchLayers(bool bInBatchLayers)
+{
+	bBatchLayers = bInBatchLayers;
+	if ( MyImage.IsValid() )
+	{
+		MyImage->SetBatchLayers(bBatchLayers);
+	}
+}
+
 void URadialProgressBar::SetBrushFromSoftMaterial(TSoftObjectPtr<UMaterialInterface> SoftMaterial)
 {
 	TWeakObjectPtr<URadialProgressBar> WeakThis(this); // using weak ptr in case 'this' has gone out of scope by the time this lambda is called
@@ -391,6 +630,11 @@ FReply URadialProgressBar::HandleMouseButtonDown(const FGeometry& Geometry, cons
 	return FReply::Unhandled();
 }
 
+void URadialProgressBar::HandleProgressAnimationFinished()
+{
+	OnProgressAnimationFinished.Broadcast();
+}
+
 #if WITH_ACCESSIBILITY
 TSharedPtr<SWidget> URadialProgressBar::GetAccessibleWidget() const
 {
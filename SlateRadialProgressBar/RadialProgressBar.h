@@ -12,6 +12,7 @@
 #include "UObject/ScriptInterface.h"
 #include "Slate/SlateTextureAtlasInterface.h"
 #include "Engine/StreamableManager.h"
+#include "RadialProgressBarTypes.h"
 #include "RadialProgressBar.generated.h"
 
 class SRadialProgressBar;
@@ -22,6 +23,7 @@ class UTexture2D;
 class ULayerImageAsset;
 struct FStreamableHandle;
 
+DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnRadialProgressAnimationFinished);
 
 
 UCLASS()
@@ -60,14 +62,66 @@ public:
 	UPROPERTY()
 	FGetFloat ProgressPercentageDelegate;
 
+	/** How the ring is drawn, the Signed Distance Field mode draws one quad per layer and the Material mode one box with the Brush material */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category=ProgressBar)
+	ERadialProgressBarRenderMode RenderMode = ERadialProgressBarRenderMode::Mesh;
+
+	/** Progress changes covering less than this many pixels of arc on screen don't repaint the bar */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category=ProgressBar, meta=(ClampMin="0.0", Units="Pixels"))
+	float ProgressChangeThreshold = 0.5f;
+
+	/** Number of segments of a full ring when adaptive resolution is off */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category=ProgressBar, meta=(ClampMin="3", ClampMax="256", EditCondition="!bAdaptiveResolution"))
+	int32 Resolution = 16;
+
+	/** Picks the number of segments from the on-screen radius of the ring instead of using Resolution */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category=ProgressBar)
+	bool bAdaptiveResolution = false;
+
+	/** Fewest segments the adaptive resolution may pick */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category=ProgressBar, meta=(ClampMin="3", ClampMax="256", EditCondition="bAdaptiveResolution"))
+	int32 MinResolution = 8;
+
+	/** Most segments the adaptive resolution may pick */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category=ProgressBar, meta=(ClampMin="3", ClampMax="256", EditCondition="bAdaptiveResolution"))
+	int32 MaxResolution = 128;
+
+	/** Largest distance, in pixels, the adaptive segments may stray from the true circle */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category=ProgressBar, meta=(ClampMin="0.01", Units="Pixels", EditCondition="bAdaptiveResolution"))
+	float MaxChordError = 0.25f;
+
+	/** Splits the ring into this many equal segments separated by gaps, each drawn once the progress fills it completely. 0 or 1 draws a continuous ring. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category=ProgressBar, meta=(ClampMin="0", ClampMax="256"))
+	int32 Segments = 0;
+
+	/** Angle left empty between two segments */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category=ProgressBar, meta=(ClampMin="0.0", ClampMax="360.0", Units="Degrees", EditCondition="Segments > 1"))
+	float SegmentGapAngle = 4.0f;
+
+	/** Rounds off both ends of the ring while it is partially filled */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category=ProgressBar, meta=(EditCondition="Segments <= 1"))
+	bool bRoundCaps = false;
+
+	/** The Material render mode passes the ring in the vertices of the box, so every bar using the Brush material shares it and batches without a dynamic material each */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category=ProgressBar, meta=(EditCondition="RenderMode == ERadialProgressBarRenderMode::Material"))
+	bool bSharedMaterial = false;
+
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category=ProgressBar)
 	UTexture2D* BarTexture;
 
+	/** Draws all layers sharing a texture with a single draw element, carrying each layer's tint in the vertex colour */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category=ProgressBar)
+	bool bBatchLayers = false;
+
 public:
 
 	UPROPERTY(EditAnywhere, Category=Events, meta=( IsBindableEvent="True" ))
 	FOnPointerEvent OnMouseButtonDownEvent;
 
+	/** Called when a transition started with AnimateProgressTo reaches its target */
+	UPROPERTY(BlueprintAssignable, Category="ProgressBar|Event")
+	FOnRadialProgressAnimationFinished OnProgressAnimationFinished;
+
 public:
 
 	/**  */
@@ -78,6 +132,76 @@ public:
 	UFUNCTION(BlueprintCallable, Category="ProgressBar")
 	void SetProgressPercentage(float InProgressPercentage);
 
+	/**
+	* Sets the progress of a progress source, the rings of the layer asset pick theirs with their ProgressSource.
+	*
+	*   @param ProgressSource Progress source to set, 0 is the ProgressPercentage of the bar. Sources from SRadialProgressBar::MaxProgressSources on are ignored.
+	*/
+	UFUNCTION(BlueprintCallable, Category="ProgressBar")
+	void SetLayerProgress(int32 ProgressSource, float InProgressPercentage);
+
+	/**
+	* Moves the progress to the target over the given duration. The bar animates itself, nothing has to be called per frame.
+	*
+	*   @param TargetPercentage Progress to end the transition on.
+	*   @param Duration Length of the transition in seconds.
+	*   @param Easing How the progress moves from its current value to the target.
+	*/
+	UFUNCTION(BlueprintCallable, Category="ProgressBar")
+	void AnimateProgressTo(float TargetPercentage, float Duration, ERadialProgressEasing Easing = ERadialProgressEasing::Linear);
+
+	/** Stops the running progress transition, leaving the progress where it currently is */
+	UFUNCTION(BlueprintCallable, Category="ProgressBar")
+	void StopProgressAnimation();
+
+	/** Sets how the ring is drawn */
+	UFUNCTION(BlueprintCallable, Category="ProgressBar")
+	void SetRenderMode(ERadialProgressBarRenderMode InRenderMode);
+
+	/** Sets the minimum on-screen arc length, in pixels, a progress change needs to cover to repaint the bar */
+	UFUNCTION(BlueprintCallable, Category="ProgressBar")
+	void SetProgressChangeThreshold(float InProgressChangeThreshold);
+
+	/** Sets the number of segments of a full ring used when adaptive resolution is off */
+	UFUNCTION(BlueprintCallable, Category="ProgressBar")
+	void SetResolution(int32 InResolution);
+
+	/** Sets whether the number of segments is picked from the on-screen radius, and the bounds and tolerance used to pick it */
+	UFUNCTION(BlueprintCallable, Category="ProgressBar")
+	void SetAdaptiveResolution(bool bInAdaptiveResolution, int32 InMinResolution = 8, int32 InMaxResolution = 128, float InMaxChordError = 0.25f);
+
+	/** Sets the number of segments the ring is split into, and the angle between them in degrees */
+	UFUNCTION(BlueprintCallable, Category="ProgressBar")
+	void SetSegments(int32 InSegments, float InSegmentGapAngle = 4.0f);
+
+	/** Sets whether both ends of the ring are rounded off while it is partially filled */
+	UFUNCTION(BlueprintCallable, Category="ProgressBar")
+	void SetRoundCaps(bool bInRoundCaps);
+
+	/** Sets whether the Material render mode passes the ring in the vertices of the box instead of a dynamic material */
+	UFUNCTION(BlueprintCallable, Category="ProgressBar")
+	void SetSharedMaterial(bool bInSharedMaterial);
+
+	/** Sets the progress so exactly the given number of segments is filled, regardless of ProgressChangeThreshold */
+	UFUNCTION(BlueprintCallable, Category="ProgressBar")
+	void SetFilledSegments(int32 InFilledSegments);
+
+	/** Sets the texture the progress bar is drawn with */
+	UFUNCTION(BlueprintCallable, Category="ProgressBar")
+	void SetBarTexture(UTexture2D* InBarTexture);
+
+	/**
+	* Sets the BarTexture to the specified Soft Texture, once it has been streamed in.
+	*
+	*   @param SoftTexture Soft Texture to draw the progress bar with.
+	*/
+	UFUNCTION(BlueprintCallable, Category="ProgressBar")
+	virtual void SetBarTextureFromSoftTexture(TSoftObjectPtr<UTexture2D> SoftTexture);
+
+	/** Sets whether all layers sharing a texture are drawn with a single draw element */
+	UFUNCTION(BlueprintCallable, Category="ProgressBar")
+	void SetBatchLayers(bool bInBatchLayers);
+
 	/**  */
 	UFUNCTION(BlueprintCallable, Category="Appearance")
 	void SetOpacity(float InOpacity);
@@ -182,6 +306,9 @@ protected:
 	// Called when we need to abort the texture being streamed in.
 	virtual void CancelImageStreaming();
 
+	// Called when we need to abort the bar texture being streamed in.
+	virtual void CancelBarTextureStreaming();
+
 	// Called when the image streaming starts, after the other one was cancelled.
 	virtual void OnImageStreamingStarted(TSoftObjectPtr<UObject> SoftObject);
 
@@ -191,6 +318,11 @@ protected:
 	//
 	FReply HandleMouseButtonDown(const FGeometry& Geometry, const FPointerEvent& MouseEvent);
 
+	void HandleProgressAnimationFinished();
+
+	/** Makes the Brush material dynamic while the Material render mode is used without a shared material, so the bar can set its parameters */
+	void EnsureMaterialRenderModeInstance();
+
 #if WITH_ACCESSIBILITY
 	virtual TSharedPtr<SWidget> GetAccessibleWidget() const override;
 #endif
@@ -198,9 +330,16 @@ protected:
 protected:
 	TSharedPtr<SRadialProgressBar> MyImage;
 
+	/** Progress of every progress source other than 0, indexed by source, kept to restore the Slate widget when it is rebuilt */
+	TArray<float> LayerProgress;
+
 	TSharedPtr<FStreamableHandle> StreamingHandle;
 	FSoftObjectPath StreamingObjectPath;
 
+	/** Streams the bar texture in, separately from the Brush so either load leaves the other one alone */
+	TSharedPtr<FStreamableHandle> BarTextureStreamingHandle;
+	FSoftObjectPath BarTextureStreamingObjectPath;
+
 protected:
 
 	PROPERTY_BINDING_IMPLEMENTATION(FSlateColor, ColorAndOpacity);
@@ -0,0 +1,268 @@
+#include "CoreMinimal.h"
+
+#if !UE_BUILD_SHIPPING
+
+#include "HAL/IConsoleManager.h"
+#include "Misc/OutputDevice.h"
+#include "Misc/AutomationTest.h"
+#include "Framework/Application/SlateApplication.h"
+#include "Input/HittestGrid.h"
+#include "Layout/Geometry.h"
+#include "Layout/WidgetPath.h"
+#include "Rendering/DrawElements.h"
+#include "Widgets/SWindow.h"
+#include "Engine/Texture2D.h"
+#include "Materials/MaterialInterface.h"
+#include "SRadialProgressBar.h"
+#include "LayerImageAsset.h"
+#include "RadialProgressBarStats.h"
+
+/**
+ * Paints radial progress bars offscreen, straight into an element list that is never rendered, and reports what one frame
+ * of them costs. Runs wherever Slate is initialized, including -nullrhi instances on build machines, as the
+ * RadialProgressBar.PaintBenchmark automation test with one case per bar count:
+ *
+ *   UnrealEditor-Cmd <Project> -nullrhi -unattended -ExecCmds="Automation RunTests RadialProgressBar" -TestExit="Automation Test Queue Empty"
+ *
+ * or as the RadialProgressBar.Benchmark console command, to try other settings:
+ *
+ *   RadialProgressBar.Benchmark Bars=1000 Batch=1 LayerClass=<Path>
+ *
+ * Arguments are Name=Value pairs, all optional:
+ *   Bars=<N>            number of bars, runs 100, 1000 and 10000 when omitted
+ *   Frames=<N>          number of measured frames, 100 by default
+ *   Resolution=<N>      segments of a full ring, 32 by default
+ *   Adaptive=<0|1>      adaptive resolution instead of Resolution
+ *   Animate=<0|1>       moves the progress of every bar every frame, on by default
+ *   Move=<0|1>          moves every bar every frame
+ *   Batch=<0|1>         batches layers sharing a resource
+ *   Mode=<Name>         render mode, Mesh, SignedDistanceField or Material, Mesh by default
+ *   Material=<Path>     material of the Image brush, required by the SignedDistanceField and Material render modes
+ *   Shared=<0|1>        shared material for the Material render mode
+ *   Segments=<N>        segmented rings
+ *   LayerClass=<Path>   ULayerImageAsset class whose layers are drawn, a single layer when omitted
+ */
+namespace RadialProgressBarBenchmark
+{
+	struct FSettings
+	{
+		int32 NumFrames = 100;
+		int32 Resolution = 32;
+		bool bAdaptiveResolution = false;
+		bool bAnimate = true;
+		bool bMove = false;
+		bool bBatchLayers = false;
+		ERadialProgressBarRenderMode RenderMode = ERadialProgressBarRenderMode::Mesh;
+		UMaterialInterface* Material = nullptr;
+		bool bSharedMaterial = false;
+		int32 Segments = 0;
+		TSubclassOf<ULayerImageAsset> LayerImageAssetClass;
+	};
+
+	/** What one run costs, the first frame apart from the averaged steady state */
+	struct FResult
+	{
+		int32 NumBars = 0;
+		int32 NumFrames = 0;
+		double FirstFrameMilliseconds = 0.0;
+		uint64 FirstFrameBufferAllocations = 0;
+		double FrameMilliseconds = 0.0;
+		double BufferAllocations = 0.0;
+		double DrawElements = 0.0;
+		double Vertices = 0.0;
+		double Indices = 0.0;
+
+		FString ToString() const
+		{
+			return FString::Printf(TEXT("RadialProgressBar.Benchmark Bars=%d Frames=%d: first frame %.3f ms, %llu buffer allocations | per frame %.3f ms, %.1f buffer allocations, %.0f draw elements, %.0f vertices, %.0f indices"),
+				NumBars, NumFrames, FirstFrameMilliseconds, FirstFrameBufferAllocations, FrameMilliseconds, BufferAllocations, DrawElements, Vertices, Indices);
+		}
+	};
+
+	/** @return an error message when the settings cannot be benchmarked, empty otherwise */
+	static FString Validate(const FSettings& Settings)
+	{
+		if (!FSlateApplication::IsInitialized())
+		{
+			return TEXT("RadialProgressBar.Benchmark needs an initialized Slate application");
+		}
+		if (Settings.RenderMode != ERadialProgressBarRenderMode::Mesh && !Settings.Material)
+		{
+			// Without a material the Image brush has no resource, and these modes would not emit anything to measure
+			return TEXT("RadialProgressBar.Benchmark needs Material=<Path> for the SignedDistanceField and Material render modes");
+		}
+		return FString();
+	}
+
+	static FResult Run(int32 NumBars, const FSettings& Settings)
+	{
+		UTexture2D* BarTexture = LoadObject<UTexture2D>(nullptr, TEXT("/Engine/EngineResources/WhiteSquareTexture.WhiteSquareTexture"));
+
+		FSlateBrush MaterialBrush;
+		MaterialBrush.SetResourceObject(Settings.Material);
+
+		TArray<TSharedRef<SRadialProgressBar>> Bars;
+		Bars.Reserve(NumBars);
+		for (int32 BarIndex = 0; BarIndex < NumBars; ++BarIndex)
+		{
+			Bars.Add(SNew(SRadialProgressBar)
+				.Image(Settings.Material ? &MaterialBrush : FCoreStyle::Get().GetDefaultBrush())
+				.ProgressPercentage(FMath::Fmod(BarIndex * 7.0f, 100.0f))
+				.LayerImageAssetClass(Settings.LayerImageAssetClass)
+				.BarTexture(BarTexture)
+				.BatchLayers(Settings.bBatchLayers)
+				.RenderMode(Settings.RenderMode)
+				.SharedMaterial(Settings.bSharedMaterial)
+				.ProgressChangeThreshold(0.0f)
+				.Resolution(Settings.Resolution)
+				.AdaptiveResolution(Settings.bAdaptiveResolution)
+				.Segments(Settings.Segments));
+		}
+
+		TSharedRef<SWindow> Window = SNew(SWindow);
+		FSlateWindowElementList ElementList(Window);
+		FHittestGrid HittestGrid;
+
+		const FVector2f BarSize = FVector2f(96.0f, 96.0f);
+		const int32 BarsPerRow = 64;
+		const FSlateRect CullingRect = FSlateRect(0.0f, 0.0f, BarsPerRow * BarSize.X, (NumBars / BarsPerRow + 1) * BarSize.Y);
+
+		const auto PaintFrame = [&](int32 FrameIndex)
+		{
+			ElementList.ResetElementList();
+
+			const FPaintArgs PaintArgs(&Window.Get(), HittestGrid, FVector2f::ZeroVector, FrameIndex / 60.0, 1.0f / 60.0f);
+			for (int32 BarIndex = 0; BarIndex < NumBars; ++BarIndex)
+			{
+				if (Settings.bAnimate)
+				{
+					Bars[BarIndex]->SetProgressPercentage(FMath::Fmod(BarIndex * 7.0f + FrameIndex * 0.5f, 100.0f));
+				}
+
+				FVector2f Position = FVector2f((BarIndex % BarsPerRow) * BarSize.X, (BarIndex / BarsPerRow) * BarSize.Y);
+				if (Settings.bMove)
+				{
+					Position.X += FrameIndex % 16;
+				}
+
+				const FGeometry Geometry = FGeometry::MakeRoot(FVector2D(BarSize), FSlateLayoutTransform(Position));
+				Bars[BarIndex]->Paint(PaintArgs, Geometry, CullingRect, ElementList, 0, FWidgetStyle(), true);
+			}
+		};
+
+		// The first frame resolves layers and sizes every buffer, it is reported apart from the steady state
+		const RadialProgressBar::FPaintCounters StartCounters = RadialProgressBar::GPaintCounters;
+		const double StartTime = FPlatformTime::Seconds();
+		PaintFrame(0);
+		const double FirstFrameTime = FPlatformTime::Seconds() - StartTime;
+		const RadialProgressBar::FPaintCounters WarmCounters = RadialProgressBar::GPaintCounters;
+
+		const double WarmTime = FPlatformTime::Seconds();
+		for (int32 FrameIndex = 1; FrameIndex <= Settings.NumFrames; ++FrameIndex)
+		{
+			PaintFrame(FrameIndex);
+		}
+		const double SteadyTime = FPlatformTime::Seconds() - WarmTime;
+		const RadialProgressBar::FPaintCounters EndCounters = RadialProgressBar::GPaintCounters;
+
+		const double NumFrames = FMath::Max(Settings.NumFrames, 1);
+
+		FResult Result;
+		Result.NumBars = NumBars;
+		Result.NumFrames = Settings.NumFrames;
+		Result.FirstFrameMilliseconds = FirstFrameTime * 1000.0;
+		Result.FirstFrameBufferAllocations = WarmCounters.BufferAllocations - StartCounters.BufferAllocations;
+		Result.FrameMilliseconds = SteadyTime * 1000.0 / NumFrames;
+		Result.BufferAllocations = (EndCounters.BufferAllocations - WarmCounters.BufferAllocations) / NumFrames;
+		Result.DrawElements = (EndCounters.DrawElements - WarmCounters.DrawElements) / NumFrames;
+		Result.Vertices = (EndCounters.VerticesEmitted - WarmCounters.VerticesEmitted) / NumFrames;
+		Result.Indices = (EndCounters.IndicesEmitted - WarmCounters.IndicesEmitted) / NumFrames;
+		return Result;
+	}
+
+	static void Execute(const TArray<FString>& Args, FOutputDevice& Ar)
+	{
+		FSettings Settings;
+		TArray<int32> BarCounts = { 100, 1000, 10000 };
+
+		for (const FString& Arg : Args)
+		{
+			FString Name, Value;
+			if (!Arg.Split(TEXT("="), &Name, &Value))
+			{
+				continue;
+			}
+
+			if (Name == TEXT("Bars"))					{ BarCounts = { FMath::Max(FCString::Atoi(*Value), 1) }; }
+			else if (Name == TEXT("Frames"))			{ Settings.NumFrames = FMath::Max(FCString::Atoi(*Value), 1); }
+			else if (Name == TEXT("Resolution"))		{ Settings.Resolution = FCString::Atoi(*Value); }
+			else if (Name == TEXT("Adaptive"))			{ Settings.bAdaptiveResolution = FCString::ToBool(*Value); }
+			else if (Name == TEXT("Animate"))			{ Settings.bAnimate = FCString::ToBool(*Value); }
+			else if (Name == TEXT("Move"))				{ Settings.bMove = FCString::ToBool(*Value); }
+			else if (Name == TEXT("Batch"))				{ Settings.bBatchLayers = FCString::ToBool(*Value); }
+			else if (Name == TEXT("Mode"))				{ Settings.RenderMode = (ERadialProgressBarRenderMode)FMath::Max<int64>(StaticEnum<ERadialProgressBarRenderMode>()->GetValueByNameString(Value), 0); }
+			else if (Name == TEXT("Material"))			{ Settings.Material = LoadObject<UMaterialInterface>(nullptr, *Value); }
+			else if (Name == TEXT("Shared"))			{ Settings.bSharedMaterial = FCString::ToBool(*Value); }
+			else if (Name == TEXT("Segments"))			{ Settings.Segments = FCString::Atoi(*Value); }
+			else if (Name == TEXT("LayerClass"))		{ Settings.LayerImageAssetClass = LoadClass<ULayerImageAsset>(nullptr, *Value); }
+		}
+
+		const FString Error = Validate(Settings);
+		if (!Error.IsEmpty())
+		{
+			Ar.Log(ELogVerbosity::Error, Error);
+			return;
+		}
+
+		for (const int32 NumBars : BarCounts)
+		{
+			Ar.Log(Run(NumBars, Settings).ToString());
+		}
+	}
+
+	static FAutoConsoleCommandWithArgsAndOutputDevice BenchmarkCommand(
+		TEXT("RadialProgressBar.Benchmark"),
+		TEXT("Paints radial progress bars offscreen and reports time, buffer allocations, draw elements, vertices and indices per frame. ")
+		TEXT("Bars=<N> Frames=<N> Resolution=<N> Adaptive=<0|1> Animate=<0|1> Move=<0|1> Batch=<0|1> Mode=<Name> Material=<Path> Shared=<0|1> Segments=<N> LayerClass=<Path>"),
+		FConsoleCommandWithArgsAndOutputDeviceDelegate::CreateStatic(&Execute));
+}
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_COMPLEX_AUTOMATION_TEST(FRadialProgressBarPaintBenchmark, "RadialProgressBar.PaintBenchmark", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+
+void FRadialProgressBarPaintBenchmark::GetTests(TArray<FString>& OutBeautifiedNames, TArray<FString>& OutTestCommands) const
+{
+	for (const int32 NumBars : { 100, 1000, 10000 })
+	{
+		OutBeautifiedNames.Add(FString::Printf(TEXT("%d Bars"), NumBars));
+		OutTestCommands.Add(FString::FromInt(NumBars));
+	}
+}
+
+bool FRadialProgressBarPaintBenchmark::RunTest(const FString& Parameters)
+{
+	const RadialProgressBarBenchmark::FSettings Settings;
+
+	const FString Error = RadialProgressBarBenchmark::Validate(Settings);
+	if (!Error.IsEmpty())
+	{
+		AddError(Error);
+		return false;
+	}
+
+	const RadialProgressBarBenchmark::FResult Result = RadialProgressBarBenchmark::Run(FCString::Atoi(*Parameters), Settings);
+	AddInfo(Result.ToString());
+
+	// Geometry is counted whether or not the renderer gave the bars a resource handle, a run drawing nothing measured nothing
+	TestTrue(TEXT("Draw elements per frame"), Result.DrawElements > 0.0);
+	TestTrue(TEXT("Vertices per frame"), Result.Vertices > 0.0);
+
+	// Animated Mesh bars reserve their buffers for full rings on the first frame, the steady state never grows them
+	TestEqual(TEXT("Buffer allocations per steady-state frame"), Result.BufferAllocations, 0.0);
+	return true;
+}
+
+#endif
+
+#endif
@@ -0,0 +1,59 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Stats/Stats.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+
+DECLARE_STATS_GROUP(TEXT("RadialProgressBar"), STATGROUP_RadialProgressBar, STATCAT_Advanced);
+
+// Stats and trace scopes compile to nothing when STATS and CPUPROFILERTRACE_ENABLED are off, as they are in shipping builds
+DECLARE_CYCLE_STAT_EXTERN(TEXT("OnPaint"), STAT_RadialProgressBar_OnPaint, STATGROUP_RadialProgressBar, TANKMAYHEM_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Resolve Layers"), STAT_RadialProgressBar_ResolveLayers, STATGROUP_RadialProgressBar, TANKMAYHEM_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Rebuild Mesh"), STAT_RadialProgressBar_RebuildMesh, STATGROUP_RadialProgressBar, TANKMAYHEM_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Update Colors"), STAT_RadialProgressBar_UpdateColors, STATGROUP_RadialProgressBar, TANKMAYHEM_API);
+
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Bars Painted"), STAT_RadialProgressBar_BarsPainted, STATGROUP_RadialProgressBar, TANKMAYHEM_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Layers Painted"), STAT_RadialProgressBar_LayersPainted, STATGROUP_RadialProgressBar, TANKMAYHEM_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Draw Elements"), STAT_RadialProgressBar_DrawElements, STATGROUP_RadialProgressBar, TANKMAYHEM_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Vertices Emitted"), STAT_RadialProgressBar_VerticesEmitted, STATGROUP_RadialProgressBar, TANKMAYHEM_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Indices Emitted"), STAT_RadialProgressBar_IndicesEmitted, STATGROUP_RadialProgressBar, TANKMAYHEM_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Resource Handle Lookups"), STAT_RadialProgressBar_ResourceHandleLookups, STATGROUP_RadialProgressBar, TANKMAYHEM_API);
+
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Mesh Cache Hits"), STAT_RadialProgressBar_MeshCacheHits, STATGROUP_RadialProgressBar, TANKMAYHEM_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Mesh Cache Misses"), STAT_RadialProgressBar_MeshCacheMisses, STATGROUP_RadialProgressBar, TANKMAYHEM_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Skipped Progress Updates"), STAT_RadialProgressBar_SkippedProgressUpdates, STATGROUP_RadialProgressBar, TANKMAYHEM_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Buffer Allocations"), STAT_RadialProgressBar_BufferAllocations, STATGROUP_RadialProgressBar, TANKMAYHEM_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Transform Only Updates"), STAT_RadialProgressBar_TransformOnlyUpdates, STATGROUP_RadialProgressBar, TANKMAYHEM_API);
+
+namespace RadialProgressBar
+{
+#if !UE_BUILD_SHIPPING
+	/** Running totals kept outside the stats system, so the benchmark command can read them in any build but shipping */
+	struct FPaintCounters
+	{
+		uint64 BufferAllocations = 0;
+		uint64 DrawElements = 0;
+		uint64 VerticesEmitted = 0;
+		uint64 IndicesEmitted = 0;
+	};
+
+	extern TANKMAYHEM_API FPaintCounters GPaintCounters;
+#endif
+
+	/**
+	 * Makes sure a mesh buffer can hold Num elements without growing while it is filled.
+	 * Buffers keep their capacity between rebuilds, so this only allocates, and counts an allocation, the first time a size is reached.
+	 */
+	template<typename ElementType, typename AllocatorType>
+	FORCEINLINE void ReserveMeshBuffer(TArray<ElementType, AllocatorType>& Buffer, int32 Num)
+	{
+		if (Buffer.Max() < Num)
+		{
+			INC_DWORD_STAT(STAT_RadialProgressBar_BufferAllocations);
+#if !UE_BUILD_SHIPPING
+			++GPaintCounters.BufferAllocations;
+#endif
+			Buffer.Reserve(Num);
+		}
+	}
+}
@@ -0,0 +1,88 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "RadialProgressBarTypes.generated.h"
+
+/** How a radial progress bar turns its progress into pixels */
+UENUM(BlueprintType)
+enum class ERadialProgressBarRenderMode : uint8
+{
+	/** Tessellated ring mesh drawn with the BarTexture */
+	Mesh,
+
+	/** One quad per layer, the ring is evaluated per pixel by the Brush material from parameters packed into the vertices, see FRadialRingSDF */
+	SignedDistanceField UMETA(DisplayName="Signed Distance Field"),
+
+	/** The Brush drawn as a single box, the ring of the first layer is handed to its dynamic material as parameters, see FRadialRingSDF */
+	Material,
+};
+
+/** What the radii of a layer ring are measured in */
+UENUM(BlueprintType)
+enum class ERadialLayerRadiusMode : uint8
+{
+	/** Radii are in slate units */
+	Absolute,
+
+	/** Radii are fractions of half the smaller side of the allotted size, a radius of 1 touches its edge */
+	RelativeToSize UMETA(DisplayName="Relative To Size"),
+};
+
+/** Which way a layer ring fills as its progress grows */
+UENUM(BlueprintType)
+enum class ERadialSweepDirection : uint8
+{
+	Clockwise,
+	CounterClockwise UMETA(DisplayName="Counter Clockwise"),
+};
+
+/** Where one layer of a radial progress bar is drawn, and which progress value fills it */
+USTRUCT(BlueprintType)
+struct FRadialLayerRing
+{
+	GENERATED_BODY()
+
+	/** What RadiusInner and RadiusOuter are measured in */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=Ring)
+	ERadialLayerRadiusMode RadiusMode = ERadialLayerRadiusMode::Absolute;
+
+	/** Distance from the centre to the inner edge of the ring */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=Ring, meta=(ClampMin="0.0"))
+	float RadiusInner = 32.0f;
+
+	/** Distance from the centre to the outer edge of the ring */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=Ring, meta=(ClampMin="0.0"))
+	float RadiusOuter = 48.0f;
+
+	/** Angle the ring starts filling from, in degrees clockwise from the right */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=Ring, meta=(Units="Degrees"))
+	float StartAngle = 0.0f;
+
+	/** Which way the ring fills */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=Ring)
+	ERadialSweepDirection SweepDirection = ERadialSweepDirection::Clockwise;
+
+	/** Progress value filling the ring: 0 is the ProgressPercentage of the bar, any other source is set with SetLayerProgress. Below SRadialProgressBar::MaxProgressSources. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=Ring, meta=(ClampMin="0", ClampMax="15"))
+	int32 ProgressSource = 0;
+
+	bool operator==(const FRadialLayerRing& Other) const
+	{
+		return RadiusMode == Other.RadiusMode
+			&& RadiusInner == Other.RadiusInner
+			&& RadiusOuter == Other.RadiusOuter
+			&& StartAngle == Other.StartAngle
+			&& SweepDirection == Other.SweepDirection
+			&& ProgressSource == Other.ProgressSource;
+	}
+};
+
+/** How an animated progress transition moves from its start to its target */
+UENUM(BlueprintType)
+enum class ERadialProgressEasing : uint8
+{
+	Linear,
+	EaseIn UMETA(DisplayName="Ease In"),
+	EaseOut UMETA(DisplayName="Ease Out"),
+	EaseInOut UMETA(DisplayName="Ease In Out"),
+};
@@ -0,0 +1,76 @@
+#include "RadialRingSDF.h"
+
+float FRadialRingSDF::Distance(FVector2f Position, float InnerRatio, float Progress)
+{
+	if (Progress <= 0.0f)
+	{
+		return UE_BIG_NUMBER;
+	}
+
+	const float Radius = Position.Size();
+	const float RingDistance = FMath::Max(InnerRatio - Radius, Radius - 1.0f);
+	if (Progress >= 1.0f)
+	{
+		return RingDistance;
+	}
+
+	float Angle = FMath::Atan2(Position.Y, Position.X);
+	if (Angle < 0.0f)
+	{
+		Angle += UE_TWO_PI;
+	}
+
+	const float Sweep = Progress * UE_TWO_PI;
+	const float WedgeDistance = Angle <= Sweep
+		? -FMath::Min(Angle, Sweep - Angle) * Radius
+		: FMath::Min(Angle - Sweep, UE_TWO_PI - Angle) * Radius;
+
+	return FMath::Max(RingDistance, WedgeDistance);
+}
+
+float FRadialRingSDF::Coverage(FVector2f Position, float InnerRatio, float Progress, float PixelWidth)
+{
+	return FMath::Clamp(0.5f - Distance(Position, InnerRatio, Progress) / PixelWidth, 0.0f, 1.0f);
+}
+
+const FName FRadialRingSDF::ProgressParameterName(TEXT("Progress"));
+const FName FRadialRingSDF::InnerRatioParameterName(TEXT("InnerRatio"));
+const FName FRadialRingSDF::RingExtentParameterName(TEXT("RingExtent"));
+const FName FRadialRingSDF::RingFrameParameterName(TEXT("RingFrame"));
+
+FVector2f FRadialRingSDF::GetBoxRingPosition(FVector2f UV, FVector2f RingExtent, FVector4f RingFrame)
+{
+	// Rotated back by the start angle and mirrored when filling counter-clockwise, like the corners of the SignedDistanceField quads
+	const FVector2f RingPosition = (UV * 2.0f - FVector2f(1.0f, 1.0f)) * RingExtent;
+	return FVector2f(RingPosition.X * RingFrame.X + RingPosition.Y * RingFrame.Y, (RingPosition.Y * RingFrame.X - RingPosition.X * RingFrame.Y) * RingFrame.Z);
+}
+
+// HLSL of Coverage shared by every material variant, each of them declares float2 Position and float PixelWidth ahead of it
+#define RADIAL_RING_COVERAGE_HLSL \
+	"if (Progress <= 0.0) return 0.0;\n" \
+	"const float TwoPi = 6.28318530718;\n" \
+	"float Radius = length(Position);\n" \
+	"float Distance = max(InnerRatio - Radius, Radius - 1.0);\n" \
+	"if (Progress < 1.0)\n" \
+	"{\n" \
+	"	float Angle = atan2(Position.y, Position.x);\n" \
+	"	Angle += Angle < 0.0 ? TwoPi : 0.0;\n" \
+	"	float Sweep = Progress * TwoPi;\n" \
+	"	float WedgeDistance = Angle <= Sweep ? -min(Angle, Sweep - Angle) * Radius : min(Angle - Sweep, TwoPi - Angle) * Radius;\n" \
+	"	Distance = max(Distance, WedgeDistance);\n" \
+	"}\n" \
+	"return saturate(0.5 - Distance / PixelWidth);\n"
+
+const TCHAR* FRadialRingSDF::MaterialHLSL = TEXT(RADIAL_RING_COVERAGE_HLSL);
+
+const TCHAR* FRadialRingSDF::MaterialBoxHLSL = TEXT(
+	"float2 RingPosition = (UV * 2.0 - 1.0) * RingExtent;\n"
+	"float2 Position = float2(RingPosition.x * RingFrame.x + RingPosition.y * RingFrame.y, (RingPosition.y * RingFrame.x - RingPosition.x * RingFrame.y) * RingFrame.z);\n"
+	"float PixelWidth = RingFrame.w;\n"
+	RADIAL_RING_COVERAGE_HLSL);
+
+const TCHAR* FRadialRingSDF::MaterialSharedHLSL = TEXT(
+	"float PixelWidth = max(length(fwidth(Position)) * 0.70710678, 1e-5);\n"
+	RADIAL_RING_COVERAGE_HLSL);
+
+#undef RADIAL_RING_COVERAGE_HLSL
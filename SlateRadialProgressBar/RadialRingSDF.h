@@ -0,0 +1,74 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Analytic description of a radial progress ring, shared by the SignedDistanceField render mode and its material.
+ *
+ * Each quad carries the ring parameters in its vertices:
+ *   TexCoords.xy       position relative to the centre, divided by the outer radius, in the frame of the ring: rotated back
+ *                      by its start angle and mirrored when it fills counter-clockwise, so the sweep always starts on +X
+ *   TexCoords.z        inner radius divided by the outer radius
+ *   TexCoords.w        progress in [0, 1]
+ *   MaterialTexCoords  x: width of one pixel divided by the outer radius, used for anti-aliasing
+ *
+ * The functions below are the CPU reference of what the material evaluates per pixel, MaterialHLSL holds the same code for a Custom node.
+ */
+struct TANKMAYHEM_API FRadialRingSDF
+{
+	/**
+	 * Signed distance from a point to the covered part of the ring, negative inside.
+	 * The sweep starts on the +X axis and goes clockwise in Slate space, distances to its edges are measured along the arc.
+	 *
+	 * @param	Position	Point relative to the centre, divided by the outer radius
+	 * @param	InnerRatio	Inner radius divided by the outer radius
+	 * @param	Progress	Covered fraction of the ring in [0, 1]
+	 */
+	static float Distance(FVector2f Position, float InnerRatio, float Progress);
+
+	/**
+	 * Fraction of a pixel covered by the ring, with a one pixel wide anti-aliased edge.
+	 *
+	 * @param	PixelWidth	Width of one pixel divided by the outer radius
+	 */
+	static float Coverage(FVector2f Position, float InnerRatio, float Progress, float PixelWidth);
+
+	/** HLSL body of Coverage for a material Custom node with float2 Position, float InnerRatio, float Progress and float PixelWidth inputs */
+	static const TCHAR* MaterialHLSL;
+
+	/**
+	 * The Material render mode draws the whole bar as one box and sets the ring as parameters of its dynamic material instead:
+	 *   Progress    scalar, progress in [0, 1]
+	 *   InnerRatio  scalar, inner radius divided by the outer radius
+	 *   RingExtent  vector, xy: half the size of the box divided by the outer radius
+	 *   RingFrame   vector, xy: cosine and sine of the start angle, z: 1 filling clockwise and -1 counter-clockwise,
+	 *               w: width of one pixel divided by the outer radius
+	 */
+	static const FName ProgressParameterName;
+	static const FName InnerRatioParameterName;
+	static const FName RingExtentParameterName;
+	static const FName RingFrameParameterName;
+
+	/**
+	 * Position in the frame of the ring, as taken by Distance, of a texture coordinate of the box.
+	 *
+	 * @param	UV			Texture coordinate of the box, [0, 0] in its top left corner and [1, 1] in its bottom right one
+	 */
+	static FVector2f GetBoxRingPosition(FVector2f UV, FVector2f RingExtent, FVector4f RingFrame);
+
+	/** HLSL body of Coverage for a material Custom node drawing the ring on a box, with float2 UV, float2 RingExtent, float4 RingFrame, float InnerRatio and float Progress inputs */
+	static const TCHAR* MaterialBoxHLSL;
+
+	/**
+	 * With a shared material the Material render mode carries the ring in the vertices of the box instead, so bars using the
+	 * same material need no dynamic instance and batch together:
+	 *   TexCoords.xy       GetBoxRingPosition of the corner, interpolated exactly across the box
+	 *   TexCoords.z        inner radius divided by the outer radius
+	 *   TexCoords.w        progress in [0, 1]
+	 *   MaterialTexCoords  texture coordinate of the box, for whatever else the material draws on it
+	 *   Color              layer, brush and widget tint
+	 */
+
+	/** HLSL body of Coverage for a material Custom node on a shared material, with float2 Position, float InnerRatio and float Progress inputs. The pixel width comes from the screen-space derivatives of Position. */
+	static const TCHAR* MaterialSharedHLSL;
+};
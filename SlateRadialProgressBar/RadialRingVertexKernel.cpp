@@ -0,0 +1,89 @@
+#include "RadialRingVertexKernel.h"
+
+// For a direction (X, Y) and the matrix [A B; C D]:
+//   Rotated  = (X * A + Y * C, X * B + Y * D)
+//   Position = Rotated * Radius + RenderTransform(Center)
+// Both paths round every product before adding it, RadialProgressBar.VertexKernel checks they agree to the bit.
+// Fused multiply-adds would round once less, so the compiler is kept from contracting the scalar loop into them.
+#if defined(__clang__)
+#pragma STDC FP_CONTRACT OFF
+#elif defined(_MSC_VER)
+#pragma fp_contract(off)
+#endif
+
+namespace RadialProgressBar
+{
+	void TransformRingVerticesScalar(const RadialMesh::FPoint* Directions, int32 NumDirections, FVector2f Center, float RadiusInner, float RadiusOuter, const FSlateRenderTransform& RenderTransform, const FSlateVertex& InnerTemplate, const FSlateVertex& OuterTemplate, FSlateVertex* OutVertices)
+	{
+		float A, B, C, D;
+		RenderTransform.GetMatrix().GetMatrix(A, B, C, D);
+		const FVector2f Origin = RenderTransform.TransformPoint(Center);
+
+		for (int32 Index = 0; Index < NumDirections; ++Index)
+		{
+			const RadialMesh::FPoint& Direction = Directions[Index];
+			const float RotatedX = Direction.X * A + Direction.Y * C;
+			const float RotatedY = Direction.X * B + Direction.Y * D;
+
+			FSlateVertex& Inner = OutVertices[Index * 2 + 0];
+			Inner = InnerTemplate;
+			Inner.Position = FVector2f(RotatedX * RadiusInner + Origin.X, RotatedY * RadiusInner + Origin.Y);
+
+			FSlateVertex& Outer = OutVertices[Index * 2 + 1];
+			Outer = OuterTemplate;
+			Outer.Position = FVector2f(RotatedX * RadiusOuter + Origin.X, RotatedY * RadiusOuter + Origin.Y);
+		}
+	}
+
+	void TransformRingVertices(const RadialMesh::FPoint* Directions, int32 NumDirections, FVector2f Center, float RadiusInner, float RadiusOuter, const FSlateRenderTransform& RenderTransform, const FSlateVertex& InnerTemplate, const FSlateVertex& OuterTemplate, FSlateVertex* OutVertices)
+	{
+		int32 Index = 0;
+
+#if PLATFORM_ENABLE_VECTORINTRINSICS
+		static_assert(sizeof(RadialMesh::FPoint) == 2 * sizeof(float), "Directions are loaded two at a time as interleaved X and Y");
+
+		float A, B, C, D;
+		RenderTransform.GetMatrix().GetMatrix(A, B, C, D);
+		const FVector2f Origin = RenderTransform.TransformPoint(Center);
+
+		const VectorRegister4Float VectorA = VectorSetFloat1(A);
+		const VectorRegister4Float VectorB = VectorSetFloat1(B);
+		const VectorRegister4Float VectorC = VectorSetFloat1(C);
+		const VectorRegister4Float VectorD = VectorSetFloat1(D);
+		const VectorRegister4Float VectorRadiusInner = VectorSetFloat1(RadiusInner);
+		const VectorRegister4Float VectorRadiusOuter = VectorSetFloat1(RadiusOuter);
+		const VectorRegister4Float OriginX = VectorSetFloat1(Origin.X);
+		const VectorRegister4Float OriginY = VectorSetFloat1(Origin.Y);
+
+		alignas(16) float InnerX[4], InnerY[4], OuterX[4], OuterY[4];
+
+		for (; Index + 4 <= NumDirections; Index += 4)
+		{
+			// Four interleaved directions, split into their X and Y
+			const VectorRegister4Float Directions01 = VectorLoad(&Directions[Index].X);
+			const VectorRegister4Float Directions23 = VectorLoad(&Directions[Index + 2].X);
+			const VectorRegister4Float X = VectorShuffle(Directions01, Directions23, 0, 2, 0, 2);
+			const VectorRegister4Float Y = VectorShuffle(Directions01, Directions23, 1, 3, 1, 3);
+
+			const VectorRegister4Float RotatedX = VectorAdd(VectorMultiply(X, VectorA), VectorMultiply(Y, VectorC));
+			const VectorRegister4Float RotatedY = VectorAdd(VectorMultiply(X, VectorB), VectorMultiply(Y, VectorD));
+
+			VectorStoreAligned(VectorAdd(VectorMultiply(RotatedX, VectorRadiusInner), OriginX), InnerX);
+			VectorStoreAligned(VectorAdd(VectorMultiply(RotatedY, VectorRadiusInner), OriginY), InnerY);
+			VectorStoreAligned(VectorAdd(VectorMultiply(RotatedX, VectorRadiusOuter), OriginX), OuterX);
+			VectorStoreAligned(VectorAdd(VectorMultiply(RotatedY, VectorRadiusOuter), OriginY), OuterY);
+
+			FSlateVertex* Pairs = OutVertices + Index * 2;
+			for (int32 Lane = 0; Lane < 4; ++Lane)
+			{
+				Pairs[Lane * 2 + 0] = InnerTemplate;
+				Pairs[Lane * 2 + 0].Position = FVector2f(InnerX[Lane], InnerY[Lane]);
+				Pairs[Lane * 2 + 1] = OuterTemplate;
+				Pairs[Lane * 2 + 1].Position = FVector2f(OuterX[Lane], OuterY[Lane]);
+			}
+		}
+#endif
+
+		TransformRingVerticesScalar(Directions + Index, NumDirections - Index, Center, RadiusInner, RadiusOuter, RenderTransform, InnerTemplate, OuterTemplate, OutVertices + Index * 2);
+	}
+}
@@ -0,0 +1,26 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Rendering/RenderingCommon.h"
+#include "RadialMeshGenerator.h"
+
+namespace RadialProgressBar
+{
+	/**
+	 * Writes one (inner, outer) vertex pair per direction into a pre-sized vertex array.
+	 * Each vertex is a copy of its template, positioned at RenderTransform(Center + Direction * Radius).
+	 * The render transform is folded into a 2x2 matrix and a translation once per ring. With vector intrinsics four directions
+	 * are transformed at a time, their X and Y in separate registers, and the directions left over go through the scalar loop.
+	 *
+	 * @param	Directions		Unit directions, as written by RadialMesh::GenerateArcDirections
+	 * @param	NumDirections	Number of directions, writes 2 * NumDirections vertices
+	 * @param	OutVertices		Receives the vertices, interleaved inner then outer
+	 */
+	TANKMAYHEM_API void TransformRingVertices(const RadialMesh::FPoint* Directions, int32 NumDirections, FVector2f Center, float RadiusInner, float RadiusOuter, const FSlateRenderTransform& RenderTransform, const FSlateVertex& InnerTemplate, const FSlateVertex& OuterTemplate, FSlateVertex* OutVertices);
+
+	/**
+	 * One direction at a time, the fallback without vector intrinsics. It does the same unfused multiplies and adds in the same
+	 * order as the vector path, so both write bit-identical vertices.
+	 */
+	TANKMAYHEM_API void TransformRingVerticesScalar(const RadialMesh::FPoint* Directions, int32 NumDirections, FVector2f Center, float RadiusInner, float RadiusOuter, const FSlateRenderTransform& RenderTransform, const FSlateVertex& InnerTemplate, const FSlateVertex& OuterTemplate, FSlateVertex* OutVertices);
+}
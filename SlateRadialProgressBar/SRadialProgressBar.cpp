@@ -2,13 +2,111 @@
 
 #include "SRadialProgressBar.h"
 #include "LayerImageAsset.h"
+#include "RadialMeshGenerator.h"
+#include "RadialRingVertexKernel.h"
+#include "RadialArcIndexBuffers.h"
+#include "RadialProgressBarStats.h"
+#include "RadialRingSDF.h"
 #include "Rendering/DrawElements.h"
+#include "Materials/MaterialInstanceDynamic.h"
+#include "Animation/CurveHandle.h"
+#include "Framework/Application/SlateApplication.h"
 #include "Widgets/IToolTip.h"
 
 #if WITH_ACCESSIBILITY
 #include "Widgets/Accessibility/SlateCoreAccessibleWidgets.h"
 #endif
 
+DEFINE_STAT(STAT_RadialProgressBar_OnPaint);
+DEFINE_STAT(STAT_RadialProgressBar_ResolveLayers);
+DEFINE_STAT(STAT_RadialProgressBar_RebuildMesh);
+DEFINE_STAT(STAT_RadialProgressBar_UpdateColors);
+DEFINE_STAT(STAT_RadialProgressBar_BarsPainted);
+DEFINE_STAT(STAT_RadialProgressBar_LayersPainted);
+DEFINE_STAT(STAT_RadialProgressBar_DrawElements);
+DEFINE_STAT(STAT_RadialProgressBar_VerticesEmitted);
+DEFINE_STAT(STAT_RadialProgressBar_IndicesEmitted);
+DEFINE_STAT(STAT_RadialProgressBar_ResourceHandleLookups);
+DEFINE_STAT(STAT_RadialProgressBar_MeshCacheHits);
+DEFINE_STAT(STAT_RadialProgressBar_MeshCacheMisses);
+DEFINE_STAT(STAT_RadialProgressBar_SkippedProgressUpdates);
+DEFINE_STAT(STAT_RadialProgressBar_BufferAllocations);
+DEFINE_STAT(STAT_RadialProgressBar_TransformOnlyUpdates);
+
+#if !UE_BUILD_SHIPPING
+RadialProgressBar::FPaintCounters RadialProgressBar::GPaintCounters;
+#endif
+
+namespace RadialProgressBar
+{
+	/** Multiplies two colours channel by channel */
+	FORCEINLINE FColor ModulateColor(const FColor A, const FColor B)
+	{
+		return FColor((A.R * B.R) / 255, (A.G * B.G) / 255, (A.B * B.B) / 255, (A.A * B.A) / 255);
+	}
+
+	/** @return how much the render transform scales lengths, including the DPI scale */
+	FORCEINLINE float GetRenderScale(const FSlateRenderTransform& RenderTransform)
+	{
+		return FMath::Sqrt(FMath::Abs(RenderTransform.GetMatrix().Determinant()));
+	}
+
+	/** Copies vertices, multiplying their colour by the given one */
+	FORCEINLINE void CopyModulatedVertices(const TArray<FSlateVertex>& Source, const FColor Color, TArray<FSlateVertex>& OutVertices)
+	{
+		OutVertices.Reset();
+		OutVertices.Append(Source);
+		for (FSlateVertex& Vertex : OutVertices)
+		{
+			Vertex.Color = ModulateColor(Vertex.Color, Color);
+		}
+	}
+
+	/**
+	 * Adds a custom verts draw element and counts what it submits. The geometry is counted even when the resource has no
+	 * handle, as with the null renderer of -nullrhi, so headless runs still measure what the bar would draw.
+	 */
+	FORCEINLINE void MakeMeshElement(FSlateWindowElementList& OutDrawElements, const int32 LayerId, const FSlateResourceHandle& ResourceHandle, const TArray<FSlateVertex>& Vertices, const TArray<SlateIndex>& Indices)
+	{
+		INC_DWORD_STAT(STAT_RadialProgressBar_DrawElements);
+		INC_DWORD_STAT_BY(STAT_RadialProgressBar_VerticesEmitted, Vertices.Num());
+		INC_DWORD_STAT_BY(STAT_RadialProgressBar_IndicesEmitted, Indices.Num());
+#if !UE_BUILD_SHIPPING
+		++GPaintCounters.DrawElements;
+		GPaintCounters.VerticesEmitted += Vertices.Num();
+		GPaintCounters.IndicesEmitted += Indices.Num();
+#endif
+
+		if (ResourceHandle.IsValid())
+		{
+			FSlateDrawElement::MakeCustomVerts(OutDrawElements, LayerId, ResourceHandle, Vertices, Indices, nullptr, 0, 0);
+		}
+	}
+
+	/** Adds a box draw element and counts what it submits */
+	FORCEINLINE void MakeBoxElement(FSlateWindowElementList& OutDrawElements, const int32 LayerId, const FPaintGeometry& PaintGeometry, const FSlateBrush* Brush, const ESlateDrawEffect DrawEffects, const FLinearColor& Tint)
+	{
+		INC_DWORD_STAT(STAT_RadialProgressBar_DrawElements);
+		INC_DWORD_STAT_BY(STAT_RadialProgressBar_VerticesEmitted, 4);
+		INC_DWORD_STAT_BY(STAT_RadialProgressBar_IndicesEmitted, 6);
+#if !UE_BUILD_SHIPPING
+		++GPaintCounters.DrawElements;
+		GPaintCounters.VerticesEmitted += 4;
+		GPaintCounters.IndicesEmitted += 6;
+#endif
+
+		FSlateDrawElement::MakeBox(OutDrawElements, LayerId, PaintGeometry, Brush, DrawEffects, Tint);
+	}
+
+	/** Resolves the radii of a ring into slate units for the given allotted size */
+	FORCEINLINE void GetRingRadii(const FRadialLayerRing& Ring, const FVector2f LocalSize, float& OutRadiusInner, float& OutRadiusOuter)
+	{
+		const float Scale = Ring.RadiusMode == ERadialLayerRadiusMode::RelativeToSize ? 0.5f * FMath::Min(LocalSize.X, LocalSize.Y) : 1.0f;
+		OutRadiusInner = FMath::Max(Ring.RadiusInner, 0.0f) * Scale;
+		OutRadiusOuter = FMath::Max(Ring.RadiusOuter, Ring.RadiusInner) * Scale;
+	}
+}
+
 
 SLATE_IMPLEMENT_WIDGET(SRadialProgressBar)
 void SRadialProgressBar::PrivateRegisterAttributes(FSlateAttributeInitializer& AttributeInitializer)
@@ -16,7 +114,12 @@ void SRadialProgressBar::PrivateRegisterAttributes(FSlateAttributeInitializer& A
 	SLATE_ADD_MEMBER_ATTRIBUTE_DEFINITION_WITH_NAME(AttributeInitializer, "Image", ImageAttribute, EInvalidateWidgetReason::Layout);
 	SLATE_ADD_MEMBER_ATTRIBUTE_DEFINITION_WITH_NAME(AttributeInitializer, "ColorAndOpacity", ColorAndOpacityAttribute, EInvalidateWidgetReason::Paint);
 	SLATE_ADD_MEMBER_ATTRIBUTE_DEFINITION_WITH_NAME(AttributeInitializer, "DesiredSizeOverride", DesiredSizeOverrideAttribute, EInvalidateWidgetReason::Layout);
-  SLATE_ADD_MEMBER_ATTRIBUTE_DEFINITION_WITH_NAME(AttributeInitializer, "ProgressPercentage", ProgressPercentageAttribute, EInvalidateWidgetReason::None);
+	// Progress does not invalidate by itself, the widget only repaints when the quantized ring actually changes
+	SLATE_ADD_MEMBER_ATTRIBUTE_DEFINITION_WITH_NAME(AttributeInitializer, "ProgressPercentage", ProgressPercentageAttribute, EInvalidateWidgetReason::None)
+		.OnValueChanged(FSlateAttributeDescriptor::FAttributeValueChangedDelegate::CreateLambda([](SWidget& Widget)
+		{
+			static_cast<SRadialProgressBar&>(Widget).OnProgressPercentageChanged();
+		}));
 }
 
 SRadialProgressBar::SRadialProgressBar()
@@ -24,6 +127,30 @@ SRadialProgressBar::SRadialProgressBar()
 	, ColorAndOpacityAttribute(*this)
 	, DesiredSizeOverrideAttribute(*this)
   , ProgressPercentageAttribute(*this)
+	, BarTexture(nullptr)
+	, bBatchLayers(false)
+	, RenderMode(ERadialProgressBarRenderMode::Mesh)
+	, ProgressChangeThreshold(0.0f)
+	, Resolution(16)
+	, bAdaptiveResolution(false)
+	, MinResolution(8)
+	, MaxResolution(128)
+	, MaxChordError(0.25f)
+	, Segments(0)
+	, SegmentGapAngle(4.0f)
+	, bRoundCaps(false)
+	, bSharedMaterial(false)
+	, MeshCircumference(0.0f)
+	, MeshPaintColor(FColor::White)
+	, AdaptiveResolutionRadius(-1.0f)
+	, AdaptiveResolution(16)
+	, bLayersDirty(true)
+	, NumProgressSources(1)
+	, ProgressAnimationStart(0.0f)
+	, ProgressAnimationTarget(0.0f)
+	, ProgressAnimationDuration(0.0f)
+	, ProgressAnimationElapsed(0.0f)
+	, ProgressAnimationEasing(ERadialProgressEasing::Linear)
 {
 	SetCanTick(false);
 	bCanSupportFocus = false;
@@ -35,8 +162,16 @@ void SRadialProgressBar::Construct( const FArguments& InArgs )
 	ColorAndOpacityAttribute.Assign(*this, InArgs._ColorAndOpacity);
   ProgressPercentageAttribute.Assign(*this, InArgs._ProgressPercentage);
 	bFlipForRightToLeftFlowDirection = InArgs._FlipForRightToLeftFlowDirection;
-	LayerImageAssetClass = InArgs._LayerImageAssetClass;
-	BarTexture = InArgs._BarTexture;
+	SetLayerImageAssetClass(InArgs._LayerImageAssetClass);
+	SetBarTexture(InArgs._BarTexture);
+	SetBatchLayers(InArgs._BatchLayers);
+	SetRenderMode(InArgs._RenderMode);
+	SetProgressChangeThreshold(InArgs._ProgressChangeThreshold);
+	SetResolution(InArgs._Resolution);
+	SetAdaptiveResolution(InArgs._AdaptiveResolution, InArgs._MinResolution, InArgs._MaxResolution, InArgs._MaxChordError);
+	SetSegments(InArgs._Segments, InArgs._SegmentGapAngle);
+	SetRoundCaps(InArgs._RoundCaps);
+	SetSharedMaterial(InArgs._SharedMaterial);
 
 	DesiredSizeOverrideAttribute.Assign(*this, InArgs._DesiredSizeOverride);
 
@@ -44,111 +179,776 @@ void SRadialProgressBar::Construct( const FArguments& InArgs )
 	{
 		SetOnMouseButtonDown(InArgs._OnMouseButtonDown);
 	}
+
+	OnProgressAnimationFinished = InArgs._OnProgressAnimationFinished;
+
+#if WITH_EDITOR
+	ULayerImageAsset::OnLayerImageAssetChanged.AddSP(this, &SRadialProgressBar::HandleLayerImageAssetChanged);
+#endif
 }
 
 // Contents of the widget
 int32 SRadialProgressBar::OnPaint( const FPaintArgs& Args, const FGeometry& AllottedGeometry, const FSlateRect& MyCullingRect, FSlateWindowElementList& OutDrawElements, int32 LayerId, const FWidgetStyle& InWidgetStyle, bool bParentEnabled ) const
 {
+	TRACE_CPUPROFILER_EVENT_SCOPE(SRadialProgressBar::OnPaint);
+	SCOPE_CYCLE_COUNTER(STAT_RadialProgressBar_OnPaint);
+	INC_DWORD_STAT(STAT_RadialProgressBar_BarsPainted);
+
+	if (bLayersDirty)
+	{
+		ResolveLayers();
+	}
+
+	// Widget opacity and ColorAndOpacity tint every layer, a fully transparent bar has nothing to draw
+	const FColor PaintColor = (InWidgetStyle.GetColorAndOpacityTint() * ColorAndOpacityAttribute.Get().GetColor(InWidgetStyle)).ToFColor(true);
+	if (PaintColor.A == 0)
+	{
+		return LayerId;
+	}
+
+	const bool bSignedDistanceField = RenderMode == ERadialProgressBarRenderMode::SignedDistanceField;
+	const bool bMaterial = RenderMode == ERadialProgressBarRenderMode::Material;
+
+	FRadialMeshKey Key;
+	Key.LocalSize = FVector2f(AllottedGeometry.GetLocalSize());
+	Key.RenderTransform = AllottedGeometry.GetAccumulatedRenderTransform();
+
+	const float OnScreenRadius = GetMaxRadiusOuter(Key.LocalSize) * RadialProgressBar::GetRenderScale(Key.RenderTransform);
+	Key.Resolution = bSignedDistanceField || bMaterial ? 0 : ComputeResolution(OnScreenRadius);
+
+	Key.QuantizedProgress.SetNumUninitialized(NumProgressSources);
+	for (int32 ProgressSource = 0; ProgressSource < NumProgressSources; ++ProgressSource)
+	{
+		Key.QuantizedProgress[ProgressSource] = QuantizeProgress(GetLayerProgress(ProgressSource));
+	}
+
+	// Only rebuild the rings when something they depend on has changed, otherwise re-submit the cached buffers
+	const bool bMeshChanged = !(Key == MeshKey);
+	if (!bMeshChanged)
+	{
+		INC_DWORD_STAT(STAT_RadialProgressBar_MeshCacheHits);
+	}
+	else
+	{
+		INC_DWORD_STAT(STAT_RadialProgressBar_MeshCacheMisses);
+
+		const bool bLocalGeometryChanged = !Key.HasSameLocalGeometry(MeshKey);
+		const bool bTransformChanged = !(Key.RenderTransform == MeshKey.RenderTransform);
+		MeshKey = MoveTemp(Key);
+		MeshCircumference = 2.0f * UE_PI * OnScreenRadius;
+
+		if (bMaterial)
+		{
+			RebuildMaterialParameters(MeshKey);
+
+			// The box of the shared material is rebuilt by the next paint with a visible colour
+			CachedVertices.Reset();
+			CachedIndices.Reset();
+			MeshPaintColor = FColor::Transparent;
+		}
+		else if (!bSignedDistanceField)
+		{
+			TRACE_CPUPROFILER_EVENT_SCOPE(SRadialProgressBar::RebuildMesh);
+			SCOPE_CYCLE_COUNTER(STAT_RadialProgressBar_RebuildMesh);
+			RebuildMesh(MeshKey, bLocalGeometryChanged, bTransformChanged);
+		}
+	}
+
+	// Colours are applied to copies of the cached rings, so fades and flashes never regenerate any geometry
+	if (!bMaterial && (bMeshChanged || PaintColor != MeshPaintColor))
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(SRadialProgressBar::UpdateColors);
+		SCOPE_CYCLE_COUNTER(STAT_RadialProgressBar_UpdateColors);
+
+		MeshPaintColor = PaintColor;
+
+		if (bSignedDistanceField)
+		{
+			RebuildSignedDistanceFieldQuads(MeshKey);
+		}
+		else if (bBatchLayers)
+		{
+			RebuildLayerBatches();
+		}
+		else
+		{
+			UpdateLayerVertexColors();
+		}
+	}
+
+	// Actually draw the vertices on screen
+	INC_DWORD_STAT_BY(STAT_RadialProgressBar_LayersPainted, Layers.Num());
+	if (bMaterial)
+	{
+		// The whole bar is one box drawn with the Image brush, its material draws the ring of the first layer from the parameters
+		const FSlateBrush* ImageBrush = ImageAttribute.Get();
+		if (ImageBrush && ImageBrush->DrawAs != ESlateBrushDrawType::NoDrawType && Layers.Num() > 0)
+		{
+			const FLinearColor Tint = FLinearColor(RadialProgressBar::ModulateColor(Layers[0].Tint, PaintColor)) * ImageBrush->GetTint(InWidgetStyle);
+			if (bSharedMaterial)
+			{
+				// The ring travels in the vertices, bars sharing the material need no dynamic instance and end up in one batch
+				// A transparent box is not drawn at all, the cached one keeps the last visible colour
+				const FColor BoxColor = Tint.ToFColor(true);
+				if (BoxColor.A > 0)
+				{
+					if (BoxColor != MeshPaintColor)
+					{
+						TRACE_CPUPROFILER_EVENT_SCOPE(SRadialProgressBar::UpdateColors);
+						SCOPE_CYCLE_COUNTER(STAT_RadialProgressBar_UpdateColors);
+
+						MeshPaintColor = BoxColor;
+						RebuildMaterialBoxQuad(MeshKey, BoxColor);
+					}
+
+					if (CachedIndices.Num() > 0)
+					{
+						RadialProgressBar::MakeMeshElement(OutDrawElements, LayerId, GetSignedDistanceFieldResourceHandle(), CachedVertices, CachedIndices);
+					}
+				}
+			}
+			else
+			{
+				ApplyMaterialParameters(*ImageBrush);
+
+				const ESlateDrawEffect DrawEffects = bParentEnabled ? ESlateDrawEffect::None : ESlateDrawEffect::DisabledEffect;
+				RadialProgressBar::MakeBoxElement(OutDrawElements, LayerId, AllottedGeometry.ToPaintGeometry(), ImageBrush, DrawEffects, Tint);
+			}
+		}
+	}
+	else if (bSignedDistanceField)
+	{
+		if (CachedIndices.Num() > 0)
+		{
+			RadialProgressBar::MakeMeshElement(OutDrawElements, LayerId, GetSignedDistanceFieldResourceHandle(), CachedVertices, CachedIndices);
+		}
+	}
+	else if (bBatchLayers)
+	{
+		for (const FRadialLayerBatch& Batch : CachedLayerBatches)
+		{
+			RadialProgressBar::MakeMeshElement(OutDrawElements, LayerId, Batch.ResourceHandle, Batch.Vertices, Batch.Indices);
+		}
+	}
+	else
+	{
+		for (const FRadialLayer& Layer : Layers)
+		{
+			const FRadialRing& Ring = Rings[Layer.RingIndex];
+			if (Ring.Indices)
+			{
+				RadialProgressBar::MakeMeshElement(OutDrawElements, LayerId, Layer.ResourceHandle, GetLayerVertices(Layer), *Ring.Indices);
+			}
+		}
+	}
+
+	return LayerId;
+}
+
+int32 SRadialProgressBar::ComputeResolution(float OnScreenRadius) const
+{
+	if (!bAdaptiveResolution)
+	{
+		return Resolution;
+	}
+
+	if (OnScreenRadius != AdaptiveResolutionRadius)
+	{
+		AdaptiveResolutionRadius = OnScreenRadius;
+
+		// Pick the segment count so the chord of each segment strays at most MaxChordError pixels from the largest outer circle
+		if (OnScreenRadius <= MaxChordError)
+		{
+			AdaptiveResolution = MinResolution;
+		}
+		else
+		{
+			const float SegmentAngle = 2.0f * FMath::Acos(1.0f - MaxChordError / OnScreenRadius);
+			AdaptiveResolution = FMath::Clamp(FMath::CeilToInt(2.0f * UE_PI / SegmentAngle), MinResolution, MaxResolution);
+		}
+	}
+
+	return AdaptiveResolution;
+}
+
+int32 SRadialProgressBar::QuantizeProgress(float InProgressPercentage) const
+{
+	const float ProgressPercentageSafe = FMath::Clamp(InProgressPercentage, 0.0f, 100.0f);
+	return FMath::RoundToInt(ProgressPercentageSafe / 100.0f * ProgressQuantizationSteps);
+}
+
+bool SRadialProgressBar::IsProgressChangeVisible(float FromPercentage, float ToPercentage) const
+{
+	const float From = FMath::Clamp(FromPercentage, 0.0f, 100.0f);
+	const float To = FMath::Clamp(ToPercentage, 0.0f, 100.0f);
+	if (From == To)
+	{
+		return false;
+	}
+
+	// Always land exactly on an empty or full ring, and never skip before the on-screen size is known
+	if (To == 0.0f || To == 100.0f || MeshCircumference <= 0.0f)
+	{
+		return true;
+	}
+
+	const float ArcPixels = FMath::Abs(To - From) / 100.0f * MeshCircumference;
+	return ArcPixels >= ProgressChangeThreshold;
+}
+
+void SRadialProgressBar::OnProgressPercentageChanged()
+{
+	OnLayerProgressChanged(0, ProgressPercentageAttribute.Get());
+}
+
+void SRadialProgressBar::OnLayerProgressChanged(int32 ProgressSource, float NewProgressPercentage)
+{
+	// No ring is filled by this source
+	if (!bLayersDirty && ProgressSource >= NumProgressSources)
+	{
+		return;
+	}
+
+	const int32 MeshQuantizedProgress = MeshKey.QuantizedProgress.IsValidIndex(ProgressSource) ? MeshKey.QuantizedProgress[ProgressSource] : INDEX_NONE;
+	const float MeshProgressPercentage = MeshQuantizedProgress * 100.0f / ProgressQuantizationSteps;
+
+	if (QuantizeProgress(NewProgressPercentage) != MeshQuantizedProgress)
+	{
+		if (MeshQuantizedProgress == INDEX_NONE || IsProgressChangeVisible(MeshProgressPercentage, NewProgressPercentage))
+		{
+			Invalidate(EInvalidateWidgetReason::Paint);
+		}
+		else
+		{
+			INC_DWORD_STAT(STAT_RadialProgressBar_SkippedProgressUpdates);
+		}
+	}
+}
+
+void SRadialProgressBar::ResolveLayers() const
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(SRadialProgressBar::ResolveLayers);
+	SCOPE_CYCLE_COUNTER(STAT_RadialProgressBar_ResolveLayers);
+
+	bLayersDirty = false;
+	Layers.Reset();
+	Rings.Reset();
+	NumProgressSources = 1;
+
+	const ULayerImageAsset* LayerAsset = LayerImageAssetClass ? GetDefault<ULayerImageAsset>(LayerImageAssetClass) : nullptr;
+	FSlateRenderer* Renderer = FSlateApplication::Get().GetRenderer();
+
+	const auto AddLayer = [this, Renderer](const FSlateBrush& LayerBrush, const FRadialLayerRing& LayerRing)
+	{
+		if (LayerBrush.DrawAs == ESlateBrushDrawType::NoDrawType)
+		{
+			return;
+		}
+
+		// Layers without their own resource are drawn with the BarTexture
+		const FSlateBrush& ResourceBrush = LayerBrush.GetResourceObject() ? LayerBrush : BarBrush;
+
+		FRadialLayer& Layer = Layers.AddDefaulted_GetRef();
+		Layer.ResourceObject = ResourceBrush.GetResourceObject();
+		if (Layer.ResourceObject && Renderer)
+		{
+			INC_DWORD_STAT(STAT_RadialProgressBar_ResourceHandleLookups);
+			Layer.ResourceHandle = Renderer->GetResourceHandle(ResourceBrush);
+		}
+		Layer.Tint = LayerBrush.TintColor.GetSpecifiedColor().ToFColor(true);
+
+		FRadialLayerRing RingParams = LayerRing;
+		RingParams.ProgressSource = FMath::Clamp(RingParams.ProgressSource, 0, MaxProgressSources - 1);
+
+		// Layers drawn on the same ring share its mesh
+		Layer.RingIndex = Rings.IndexOfByPredicate([&RingParams](const FRadialRing& Ring) { return Ring.Params == RingParams; });
+		if (Layer.RingIndex == INDEX_NONE)
+		{
+			Layer.RingIndex = Rings.AddDefaulted();
+			Rings[Layer.RingIndex].Params = RingParams;
+			NumProgressSources = FMath::Max(NumProgressSources, RingParams.ProgressSource + 1);
+		}
+	};
+
+	if (LayerAsset)
+	{
+		Layers.Reserve(LayerAsset->Layers.Num());
+		for (int32 LayerIndex = 0; LayerIndex < LayerAsset->Layers.Num(); ++LayerIndex)
+		{
+			AddLayer(LayerAsset->Layers[LayerIndex], LayerAsset->LayerRings.IsValidIndex(LayerIndex) ? LayerAsset->LayerRings[LayerIndex] : FRadialLayerRing());
+		}
+	}
+	else
+	{
+		// Without a layer asset the bar is a single untinted layer on the default ring
+		AddLayer(FSlateBrush(), FRadialLayerRing());
+	}
+}
+
+void SRadialProgressBar::InvalidateLayers()
+{
+	bLayersDirty = true;
+
+	// Batched and analytic meshes carry per-layer data and have to be rebuilt
+	MeshKey = FRadialMeshKey();
+	Invalidate(EInvalidateWidgetReason::Paint);
+}
+
+#if WITH_EDITOR
+void SRadialProgressBar::HandleLayerImageAssetChanged(const ULayerImageAsset* ChangedAsset)
+{
+	// Edits to a parent class' defaults are inherited by the class this bar draws
+	if (LayerImageAssetClass && LayerImageAssetClass->IsChildOf(ChangedAsset->GetClass()))
+	{
+		InvalidateLayers();
+	}
+}
+#endif
+
+FSlateResourceHandle SRadialProgressBar::GetSignedDistanceFieldResourceHandle() const
+{
+	// The ring material comes from the Image brush, only look its handle up again when its resource changed
+	const FSlateBrush* ImageBrush = ImageAttribute.Get();
+	const UObject* ImageResourceObject = ImageBrush ? ImageBrush->GetResourceObject() : nullptr;
+	if (ImageResourceObject != SignedDistanceFieldResourceObject.Get())
+	{
+		SignedDistanceFieldResourceObject = ImageResourceObject;
+		SignedDistanceFieldResourceHandle = FSlateResourceHandle();
+		if (ImageResourceObject)
+		{
+			INC_DWORD_STAT(STAT_RadialProgressBar_ResourceHandleLookups);
+			SignedDistanceFieldResourceHandle = FSlateApplication::Get().GetRenderer()->GetResourceHandle(*ImageBrush);
+		}
+	}
+
+	return SignedDistanceFieldResourceHandle;
+}
+
+void SRadialProgressBar::RebuildSignedDistanceFieldQuads(const FRadialMeshKey& Key) const
+{
+	CachedVertices.Reset();
+	CachedIndices.Reset();
+
+	const FVector2f CenterPoint = Key.LocalSize / 2.0f;
+	const float RenderScale = RadialProgressBar::GetRenderScale(Key.RenderTransform);
+
+	static const FVector2f Corners[4] = { FVector2f(-1, -1), FVector2f(1, -1), FVector2f(-1, 1), FVector2f(1, 1) };
+
+	const int32 NumLayers = Layers.Num();
+	RadialProgressBar::ReserveMeshBuffer(CachedVertices, NumLayers * 4);
+	RadialProgressBar::ReserveMeshBuffer(CachedIndices, NumLayers * 6);
+
+	// One quad per layer, the layer tint is carried in the vertex colour so every layer shares a single draw element
+	for (const FRadialLayer& Layer : Layers)
+	{
+		const FRadialLayerRing& Ring = Rings[Layer.RingIndex].Params;
+		const float Progress = (float)Key.QuantizedProgress[Ring.ProgressSource] / ProgressQuantizationSteps;
+
+		float RadiusInner, RadiusOuter;
+		RadialProgressBar::GetRingRadii(Ring, Key.LocalSize, RadiusInner, RadiusOuter);
+		if (Progress <= 0.0f || RadiusOuter <= 0.0f)
+		{
+			continue;
+		}
 
-	const ULayerImageAsset* LayerAsset = GetDefault<ULayerImageAsset>(LayerImageAssetClass);
-	ESlateDrawEffect DrawEffects = ESlateDrawEffect::NoPixelSnapping;
-
-    for (const FSlateBrush& ImageBrush : LayerAsset->Layers){
-
-       TArray<FSlateVertex> Vertices;
-       TArray<SlateIndex> Indices;
-
-       FVector2D CenterPoint = AllottedGeometry.GetLocalSize() / 2.0f;
-	     const FVector2f fCenterPoint = FVector2f(CenterPoint);
-
-       float RadiusInner = 32.0f; // Radius Inner circle
-	     float RadiusOuter = 16.0f; // Radius outer circle
-
-	     const FVector2f TexCoord = {0, 0};
-	     const FColor ColorInnerCircle = FColor::White;
-	     const FColor ColorOuterCircle = FColor::Red;
-       const FColor ColorInnerCircleCenter = FColor::Transparent;
-
-       constexpr int BASE_INDEX = 1; // Needed for the Centre vertex
-       constexpr int Resolution = 16; // Number of vertices for each circle
-
-	     const float ProgressPercentageSafe = FMath::Clamp(ProgressPercentageAttribute.Get(), 0.0f, 100.0f);
-	     const int NumberOfQuadsToOutput = FMath::Floor(ProgressPercentageSafe / 100.0f * (Resolution-1));
-      
-
-       // Add a vertice in the centre of the circle
-       Vertices.Add(FSlateVertex::Make<ESlateVertexRounding::Disabled>(AllottedGeometry.GetAccumulatedRenderTransform(), fCenterPoint, TexCoord, TexCoord, ColorInnerCircleCenter));
-
-       // Generate vertices for the inner circle
-       for (int i = 0; i < Resolution; ++i)
-       {
-         float Angle = i / (float)Resolution * 2 * UE_PI;
-         float X = CenterPoint.X + FMath::Cos(Angle) * RadiusInner;
-         float Y = CenterPoint.Y + FMath::Sin(Angle) * RadiusInner;
-         const FVector2f Position = FVector2f(X, Y);
-         Vertices.Add(FSlateVertex::Make<ESlateVertexRounding::Disabled>(AllottedGeometry.GetAccumulatedRenderTransform(), Position, TexCoord, TexCoord, ColorInnerCircle));
-       }
-       // Generate vertices for the outer circle
-       for (int i = 0; i < Resolution; ++i)
-       {
-         float Angle = i / (float)Resolution * 2 * UE_PI;
-         float X = (CenterPoint.X + FMath::Cos(Angle) * RadiusInner) + FMath::Cos(Angle) * RadiusOuter;
-         float Y = (CenterPoint.Y + FMath::Sin(Angle) * RadiusInner) + FMath::Sin(Angle) * RadiusOuter;
-         const FVector2f Position = FVector2f(X, Y);
-         Vertices.Add(FSlateVertex::Make<ESlateVertexRounding::Disabled>(AllottedGeometry.GetAccumulatedRenderTransform(), Position, TexCoord, TexCoord, ColorOuterCircle));
-       }
-
-
-       // Generate indices
-    for(int CurrentQuadIndex = 0; CurrentQuadIndex < NumberOfQuadsToOutput; ++CurrentQuadIndex)
-    {
-        if(CurrentQuadIndex == Resolution-1) break; // Never render the last quad
-        
-        int BottomLeftIndex = CurrentQuadIndex + BASE_INDEX;
-        int BottomRightIndex = CurrentQuadIndex + 1 + BASE_INDEX;
-        int TopLeftIndex = BottomLeftIndex + Resolution;
-        int TopRightIndex = BottomRightIndex + Resolution;
-        
-        Indices.Add(BottomLeftIndex); Indices.Add(TopLeftIndex); Indices.Add(BottomRightIndex);
-        Indices.Add(TopLeftIndex); Indices.Add(TopRightIndex); Indices.Add(BottomRightIndex);
-    }
-
-    // Handle the last quad
-    {
-        int BottomLeftIndex = FMath::Min(NumberOfQuadsToOutput, Resolution-BASE_INDEX) + BASE_INDEX;
-        int TopLeftIndex = BottomLeftIndex + Resolution;
-        int BottomRightIndex = Vertices.Num();
-        int TopRightIndex = Vertices.Num()+1;
-                
-        Indices.Add(BottomLeftIndex); Indices.Add(TopLeftIndex); Indices.Add(BottomRightIndex);
-        Indices.Add(TopLeftIndex); Indices.Add(TopRightIndex); Indices.Add(BottomRightIndex);
-
-        float Angle = ProgressPercentageSafe / 100.0f * 2 * UE_PI;
-        float X1 = CenterPoint.X + FMath::Cos(Angle) * RadiusInner;
-        float Y1 = CenterPoint.Y + FMath::Sin(Angle) * RadiusInner;
-        float X2 = (CenterPoint.X + FMath::Cos(Angle) * RadiusInner) + FMath::Cos(Angle) * RadiusOuter;
-        float Y2 = (CenterPoint.Y + FMath::Sin(Angle) * RadiusInner) + FMath::Sin(Angle) * RadiusOuter;
-        const FVector2f P1 = FVector2f(X1, Y1);
-        const FVector2f P2 = FVector2f(X2, Y2);
-        Vertices.Add(FSlateVertex::Make<ESlateVertexRounding::Disabled>(AllottedGeometry.GetAccumulatedRenderTransform(), P1, TexCoord, TexCoord, ColorInnerCircle));
-        Vertices.Add(FSlateVertex::Make<ESlateVertexRounding::Disabled>(AllottedGeometry.GetAccumulatedRenderTransform(), P2, TexCoord, TexCoord, ColorOuterCircle));
-    }
-
-     // Actually draw the vertices on screen
-     
-	 if(BarTexture){
-		    FSlateBrush RadialProgressBarBrush;
-        RadialProgressBarBrush.SetResourceObject(BarTexture);
-        RadialProgressBarBrush.DrawAs = ESlateBrushDrawType::Image;
-
-	     const FSlateResourceHandle& CircularTextureResource = FSlateApplication::Get().GetRenderer()->GetResourceHandle(MyCircularProgressBarBrush);
-
-		FSlateDrawElement::MakeCustomVerts(OutDrawElements, LayerId, CircularTextureResource, Vertices, Indices, nullptr, 0, 0);
-	 };
-
-
-}
-return LayerId;
+		const float InnerRatio = RadiusInner / RadiusOuter;
+
+		// Grow the quad by a pixel so the anti-aliased outer edge is not clipped
+		const float PixelWidth = 1.0f / FMath::Max(RadiusOuter * RenderScale, KINDA_SMALL_NUMBER);
+		const float Extent = 1.0f + PixelWidth;
+		const FVector2f MaterialTexCoords = FVector2f(PixelWidth, 0.0f);
+
+		// The material always fills clockwise from +X, so the corners are given in the frame of the ring: rotated back by its start angle and mirrored when it fills counter-clockwise
+		float StartSin, StartCos;
+		FMath::SinCos(&StartSin, &StartCos, FMath::DegreesToRadians(Ring.StartAngle));
+		const float Mirror = Ring.SweepDirection == ERadialSweepDirection::CounterClockwise ? -1.0f : 1.0f;
+
+		const SlateIndex BaseVertex = (SlateIndex)CachedVertices.Num();
+		const FColor LayerTint = RadialProgressBar::ModulateColor(Layer.Tint, MeshPaintColor);
+
+		for (const FVector2f& Corner : Corners)
+		{
+			const FVector2f RingPosition = Corner * Extent;
+			const FVector2f FramePosition = FVector2f(RingPosition.X * StartCos + RingPosition.Y * StartSin, (RingPosition.Y * StartCos - RingPosition.X * StartSin) * Mirror);
+			const FVector4f TexCoords = FVector4f(FramePosition.X, FramePosition.Y, InnerRatio, Progress);
+			CachedVertices.Add(FSlateVertex::Make<ESlateVertexRounding::Disabled>(Key.RenderTransform, CenterPoint + RingPosition * RadiusOuter, TexCoords, MaterialTexCoords, LayerTint));
+		}
+
+		CachedIndices.Add(BaseVertex + 0); CachedIndices.Add(BaseVertex + 2); CachedIndices.Add(BaseVertex + 1);
+		CachedIndices.Add(BaseVertex + 2); CachedIndices.Add(BaseVertex + 3); CachedIndices.Add(BaseVertex + 1);
+	}
+}
+
+void SRadialProgressBar::RebuildMaterialParameters(const FRadialMeshKey& Key) const
+{
+	MaterialParameters = FRadialMaterialParameters();
+	if (Layers.Num() == 0)
+	{
+		return;
+	}
+
+	const FRadialLayerRing& Ring = Rings[Layers[0].RingIndex].Params;
+
+	float RadiusInner, RadiusOuter;
+	RadialProgressBar::GetRingRadii(Ring, Key.LocalSize, RadiusInner, RadiusOuter);
+	if (RadiusOuter <= 0.0f)
+	{
+		return;
+	}
+
+	float StartSin, StartCos;
+	FMath::SinCos(&StartSin, &StartCos, FMath::DegreesToRadians(Ring.StartAngle));
+	const float Mirror = Ring.SweepDirection == ERadialSweepDirection::CounterClockwise ? -1.0f : 1.0f;
+	const float PixelWidth = 1.0f / FMath::Max(RadiusOuter * RadialProgressBar::GetRenderScale(Key.RenderTransform), KINDA_SMALL_NUMBER);
+
+	MaterialParameters.Progress = (float)Key.QuantizedProgress[Ring.ProgressSource] / ProgressQuantizationSteps;
+	MaterialParameters.InnerRatio = RadiusInner / RadiusOuter;
+	MaterialParameters.RingExtent = Key.LocalSize / (2.0f * RadiusOuter);
+	MaterialParameters.RingFrame = FVector4f(StartCos, StartSin, Mirror, PixelWidth);
+}
+
+void SRadialProgressBar::ApplyMaterialParameters(const FSlateBrush& ImageBrush) const
+{
+	// Without a dynamic material the brush is drawn as it is, its material only sees the box texture coordinates
+	UMaterialInstanceDynamic* DynamicMaterial = Cast<UMaterialInstanceDynamic>(ImageBrush.GetResourceObject());
+	if (!DynamicMaterial || (DynamicMaterial == AppliedMaterial.Get() && MaterialParameters == AppliedMaterialParameters))
+	{
+		return;
+	}
+
+	AppliedMaterial = DynamicMaterial;
+	AppliedMaterialParameters = MaterialParameters;
+
+	DynamicMaterial->SetScalarParameterValue(FRadialRingSDF::ProgressParameterName, MaterialParameters.Progress);
+	DynamicMaterial->SetScalarParameterValue(FRadialRingSDF::InnerRatioParameterName, MaterialParameters.InnerRatio);
+	DynamicMaterial->SetVectorParameterValue(FRadialRingSDF::RingExtentParameterName, FLinearColor(MaterialParameters.RingExtent.X, MaterialParameters.RingExtent.Y, 0.0f, 0.0f));
+	DynamicMaterial->SetVectorParameterValue(FRadialRingSDF::RingFrameParameterName, FLinearColor(MaterialParameters.RingFrame.X, MaterialParameters.RingFrame.Y, MaterialParameters.RingFrame.Z, MaterialParameters.RingFrame.W));
+}
+
+void SRadialProgressBar::RebuildMaterialBoxQuad(const FRadialMeshKey& Key, FColor BoxColor) const
+{
+	CachedVertices.Reset();
+	CachedIndices.Reset();
+
+	RadialProgressBar::ReserveMeshBuffer(CachedVertices, 4);
+	RadialProgressBar::ReserveMeshBuffer(CachedIndices, 6);
+
+	static const FVector2f Corners[4] = { FVector2f(0, 0), FVector2f(1, 0), FVector2f(0, 1), FVector2f(1, 1) };
+
+	// The ring position is affine in the box coordinates, so giving it at the corners is exact everywhere in between
+	for (const FVector2f& Corner : Corners)
+	{
+		const FVector2f RingPosition = FRadialRingSDF::GetBoxRingPosition(Corner, MaterialParameters.RingExtent, MaterialParameters.RingFrame);
+		const FVector4f TexCoords = FVector4f(RingPosition.X, RingPosition.Y, MaterialParameters.InnerRatio, MaterialParameters.Progress);
+		CachedVertices.Add(FSlateVertex::Make<ESlateVertexRounding::Disabled>(Key.RenderTransform, Corner * Key.LocalSize, TexCoords, Corner, BoxColor));
+	}
+
+	CachedIndices.Add(0); CachedIndices.Add(2); CachedIndices.Add(1);
+	CachedIndices.Add(2); CachedIndices.Add(3); CachedIndices.Add(1);
+}
+
+void SRadialProgressBar::RebuildLayerBatches() const
+{
+	// Batches are reused in place so their buffers keep their capacity from one rebuild to the next
+	for (FRadialLayerBatch& Batch : CachedLayerBatches)
+	{
+		Batch.Vertices.Reset();
+		Batch.Indices.Reset();
+	}
+
+	// Batches are reserved for the largest mesh a ring can reach, a full capped arc or every segment, so growing progress never reallocates them
+	const int32 MaxPairs = RadialMesh::GetMaxPairCount(MeshKey.Resolution);
+	const int32 MaxCapPoints = RadialMesh::GetRoundCapPointCount(MeshKey.Resolution);
+	const int32 MaxArcVertices = MaxPairs * 2 + MaxCapPoints * 2;
+	const int32 MaxArcIndices = (MaxPairs - 1) * 6 + (MaxCapPoints - 2) * 6;
+
+	int32 NumBatches = 0;
+	for (const FRadialLayer& Layer : Layers)
+	{
+		const FRadialRing& Ring = Rings[Layer.RingIndex];
+		if (!Ring.Indices)
+		{
+			continue;
+		}
+
+		const UObject* LayerResourceObject = Layer.ResourceObject;
+		FRadialLayerBatch* Batch = MakeArrayView(CachedLayerBatches.GetData(), NumBatches).FindByPredicate([LayerResourceObject](const FRadialLayerBatch& Other) { return Other.ResourceObject == LayerResourceObject; });
+		if (!Batch)
+		{
+			if (NumBatches == CachedLayerBatches.Num())
+			{
+				INC_DWORD_STAT(STAT_RadialProgressBar_BufferAllocations);
+#if !UE_BUILD_SHIPPING
+				++RadialProgressBar::GPaintCounters.BufferAllocations;
+#endif
+				CachedLayerBatches.AddDefaulted();
+			}
+
+			Batch = &CachedLayerBatches[NumBatches++];
+			Batch->ResourceObject = LayerResourceObject;
+			Batch->ResourceHandle = Layer.ResourceHandle;
+		}
+
+		// Append a copy of the ring, the layer tint is carried in the vertex colour so layers sharing a resource only need one draw element
+		const SlateIndex BaseVertex = (SlateIndex)Batch->Vertices.Num();
+		const FColor LayerTint = RadialProgressBar::ModulateColor(Layer.Tint, MeshPaintColor);
+
+		RadialProgressBar::ReserveMeshBuffer(Batch->Vertices, BaseVertex + FMath::Max(MaxArcVertices, Ring.SegmentVertices.Num()));
+		for (const FSlateVertex& Vertex : Ring.Vertices)
+		{
+			FSlateVertex& LayerVertex = Batch->Vertices.Add_GetRef(Vertex);
+			LayerVertex.Color = RadialProgressBar::ModulateColor(Vertex.Color, LayerTint);
+		}
+
+		const int32 MaxSegmentIndices = Ring.PairsPerSegment >= 2 ? Segments * (Ring.PairsPerSegment - 1) * 6 : 0;
+		RadialProgressBar::ReserveMeshBuffer(Batch->Indices, Batch->Indices.Num() + FMath::Max(MaxArcIndices, MaxSegmentIndices));
+		for (const SlateIndex Index : *Ring.Indices)
+		{
+			Batch->Indices.Add(BaseVertex + Index);
+		}
+	}
+
+	if (CachedLayerBatches.Num() > NumBatches)
+	{
+		CachedLayerBatches.RemoveAt(NumBatches, CachedLayerBatches.Num() - NumBatches);
+	}
+}
+
+void SRadialProgressBar::RebuildMesh(const FRadialMeshKey& Key, bool bLocalGeometryChanged, bool bTransformChanged) const
+{
+	for (FRadialRing& Ring : Rings)
+	{
+		const int32 QuantizedProgress = Key.QuantizedProgress[Ring.Params.ProgressSource];
+		if (Segments > 1)
+		{
+			// Segments are only tessellated when the local geometry changes, progress just selects how many of them are drawn
+			if (bLocalGeometryChanged)
+			{
+				TessellateSegments(Ring, Key);
+			}
+			if (bLocalGeometryChanged || bTransformChanged)
+			{
+				TransformRing(Ring, Key, Ring.SegmentVertices);
+				Ring.FilledSegments = INDEX_NONE;
+			}
+			ApplySegmentFill(Ring, QuantizedProgress);
+		}
+		else
+		{
+			// Rings whose progress source did not move keep their local arc, a moving bar only applies its new transform to it
+			const bool bTessellate = bLocalGeometryChanged || Ring.QuantizedProgress != QuantizedProgress;
+			if (bTessellate)
+			{
+				TessellateRing(Ring, Key);
+			}
+			if (bTessellate || bTransformChanged)
+			{
+				TransformRing(Ring, Key, Ring.Vertices);
+				++Ring.Revision;
+			}
+		}
+
+		if (!bLocalGeometryChanged && bTransformChanged)
+		{
+			INC_DWORD_STAT(STAT_RadialProgressBar_TransformOnlyUpdates);
+		}
+	}
+}
+
+void SRadialProgressBar::TessellateRing(FRadialRing& Ring, const FRadialMeshKey& Key) const
+{
+	Ring.Directions.Reset();
+	Ring.LocalCapVertices.Reset();
+	Ring.Indices = nullptr;
+	Ring.QuantizedProgress = Key.QuantizedProgress[Ring.Params.ProgressSource];
+
+	const FVector2f CenterPoint = Key.LocalSize / 2.0f;
+
+	float RadiusInner, RadiusOuter;
+	RadialProgressBar::GetRingRadii(Ring.Params, Key.LocalSize, RadiusInner, RadiusOuter);
+
+	RadialMesh::FArcParams Arc;
+	Arc.CenterX = CenterPoint.X;
+	Arc.CenterY = CenterPoint.Y;
+	Arc.RadiusInner = RadiusInner;
+	Arc.RadiusOuter = RadiusOuter;
+	Arc.StartFraction = Ring.Params.StartAngle / 360.0f;
+	Arc.SweepFraction = (float)Ring.QuantizedProgress / ProgressQuantizationSteps;
+	Arc.SweepFraction *= Ring.Params.SweepDirection == ERadialSweepDirection::CounterClockwise ? -1.0f : 1.0f;
+	Arc.Resolution = Key.Resolution;
+
+	// Reserve for a full ring so progress changes never grow the buffers, even when the first tessellation covers nothing
+	RadialProgressBar::ReserveMeshBuffer(Ring.Directions, RadialMesh::GetMaxPairCount(Arc.Resolution));
+	if (bRoundCaps)
+	{
+		RadialProgressBar::ReserveMeshBuffer(Ring.LocalCapVertices, RadialMesh::GetRoundCapPointCount(Arc.Resolution) * 2);
+	}
+
+	// Only the covered arc is generated, as the directions of its (inner, outer) vertex pairs
+	RadialMesh::FPoint Directions[RadialMesh::MaxPairCount];
+	const int32 NumberOfPairs = RadialMesh::GenerateArcDirections(Arc, Directions);
+	if (NumberOfPairs < 2)
+	{
+		return;
+	}
+
+	Ring.Directions.Append(Directions, NumberOfPairs);
+
+	// Rounded caps follow the arc pairs, a full ring has no ends to cap. They are kept in local space like the arc.
+	int32 NumCapPoints = 0;
+	if (bRoundCaps)
+	{
+		RadialMesh::FPoint CapPoints[RadialMesh::MaxRoundCapPointCount];
+		for (const bool bEndCap : { false, true })
+		{
+			NumCapPoints = RadialMesh::GenerateRoundCap(Arc, bEndCap, CapPoints);
+			for (int32 PointIndex = 0; PointIndex < NumCapPoints; ++PointIndex)
+			{
+				const FVector2f Position = FVector2f(CapPoints[PointIndex].X, CapPoints[PointIndex].Y);
+				Ring.LocalCapVertices.Add(FSlateVertex::Make<ESlateVertexRounding::Disabled>(FSlateRenderTransform(), Position, FVector2f::ZeroVector, FVector2f::ZeroVector, FColor::White));
+			}
+		}
+	}
+
+	// The indices only depend on the number of pairs and cap points, submit the shared list instead of generating them
+	Ring.Indices = NumCapPoints > 0 ? &RadialProgressBar::GetSharedRoundCappedArcIndices(NumberOfPairs, NumCapPoints) : &RadialProgressBar::GetSharedArcIndices(NumberOfPairs);
+}
+
+void SRadialProgressBar::TessellateSegments(FRadialRing& Ring, const FRadialMeshKey& Key) const
+{
+	Ring.Directions.Reset();
+	Ring.LocalCapVertices.Reset();
+	Ring.PairsPerSegment = 0;
+
+	const float Mirror = Ring.Params.SweepDirection == ERadialSweepDirection::CounterClockwise ? -1.0f : 1.0f;
+	const float SegmentFraction = 1.0f / Segments;
+	const float GapFraction = FMath::Clamp(SegmentGapAngle / 360.0f, 0.0f, SegmentFraction);
+	if (SegmentFraction - GapFraction <= 0.0f)
+	{
+		return;
+	}
+
+	RadialMesh::FArcParams Arc;
+	Arc.SweepFraction = (SegmentFraction - GapFraction) * Mirror;
+	Arc.Resolution = Key.Resolution;
+
+	// Every segment is the same arc rotated to its place, so they all have the same number of pairs
+	RadialMesh::FPoint Directions[RadialMesh::MaxPairCount];
+	for (int32 SegmentIndex = 0; SegmentIndex < Segments; ++SegmentIndex)
+	{
+		Arc.StartFraction = Ring.Params.StartAngle / 360.0f + (SegmentIndex * SegmentFraction + GapFraction * 0.5f) * Mirror;
+
+		const int32 NumberOfPairs = RadialMesh::GenerateArcDirections(Arc, Directions);
+		if (SegmentIndex == 0)
+		{
+			Ring.PairsPerSegment = NumberOfPairs;
+			RadialProgressBar::ReserveMeshBuffer(Ring.Directions, Segments * NumberOfPairs);
+		}
+
+		Ring.Directions.Append(Directions, NumberOfPairs);
+	}
+}
+
+void SRadialProgressBar::TransformRing(const FRadialRing& Ring, const FRadialMeshKey& Key, TArray<FSlateVertex>& OutVertices) const
+{
+	OutVertices.Reset();
+
+	// The local buffers are reserved for the largest mesh they can hold, so is the transformed one
+	RadialProgressBar::ReserveMeshBuffer(OutVertices, Ring.Directions.Max() * 2 + Ring.LocalCapVertices.Max());
+
+	const int32 NumberOfPairs = Ring.Directions.Num();
+	if (NumberOfPairs == 0)
+	{
+		return;
+	}
+
+	const FVector2f CenterPoint = Key.LocalSize / 2.0f;
+
+	float RadiusInner, RadiusOuter;
+	RadialProgressBar::GetRingRadii(Ring.Params, Key.LocalSize, RadiusInner, RadiusOuter);
+
+	// Rings are white, so the layer tint, ColorAndOpacity and widget opacity colour them the same way in every render mode.
+	// Inner and outer vertices only differ by their position, and so do the round caps made by TessellateRing.
+	const FSlateVertex Template = FSlateVertex::Make<ESlateVertexRounding::Disabled>(Key.RenderTransform, CenterPoint, FVector2f::ZeroVector, FVector2f::ZeroVector, FColor::White);
+
+	OutVertices.SetNumUninitialized(NumberOfPairs * 2);
+	RadialProgressBar::TransformRingVertices(Ring.Directions.GetData(), NumberOfPairs, CenterPoint, RadiusInner, RadiusOuter, Key.RenderTransform, Template, Template, OutVertices.GetData());
+
+	for (const FSlateVertex& LocalVertex : Ring.LocalCapVertices)
+	{
+		FSlateVertex& Vertex = OutVertices.Add_GetRef(LocalVertex);
+		Vertex.Position = Key.RenderTransform.TransformPoint(LocalVertex.Position);
+	}
+}
+
+void SRadialProgressBar::ApplySegmentFill(FRadialRing& Ring, int32 QuantizedProgress) const
+{
+	Ring.QuantizedProgress = QuantizedProgress;
+
+	// A segment is only drawn once the progress covers all of it, give or take the half step lost to quantization
+	const int32 FilledSegments = Ring.PairsPerSegment >= 2 ? (2 * QuantizedProgress * Segments + Segments) / (2 * ProgressQuantizationSteps) : 0;
+	if (FilledSegments == Ring.FilledSegments)
+	{
+		return;
+	}
+
+	Ring.FilledSegments = FilledSegments;
+	Ring.Vertices.Reset();
+	Ring.Indices = nullptr;
+	++Ring.Revision;
+
+	RadialProgressBar::ReserveMeshBuffer(Ring.Vertices, Ring.SegmentVertices.Num());
+	if (FilledSegments > 0)
+	{
+		Ring.Vertices.Append(Ring.SegmentVertices.GetData(), FilledSegments * Ring.PairsPerSegment * 2);
+		Ring.Indices = &RadialProgressBar::GetSharedSegmentedArcIndices(Ring.PairsPerSegment, FilledSegments);
+	}
+}
+
+void SRadialProgressBar::UpdateLayerVertexColors() const
+{
+	for (FRadialLayer& Layer : Layers)
+	{
+		const FRadialRing& Ring = Rings[Layer.RingIndex];
+		const FColor LayerColor = RadialProgressBar::ModulateColor(Layer.Tint, MeshPaintColor);
+
+		// Only layers whose ring or colour changed since their last pass are copied again
+		if (Layer.RingRevision == Ring.Revision && Layer.VertexColor == LayerColor)
+		{
+			continue;
+		}
+
+		Layer.RingRevision = Ring.Revision;
+		Layer.VertexColor = LayerColor;
+
+		// Untinted layers submit the ring itself
+		if (LayerColor == FColor::White)
+		{
+			Layer.Vertices.Reset();
+		}
+		else
+		{
+			RadialProgressBar::ReserveMeshBuffer(Layer.Vertices, Ring.Vertices.Max());
+			RadialProgressBar::CopyModulatedVertices(Ring.Vertices, LayerColor, Layer.Vertices);
+		}
+	}
+}
+
+const TArray<FSlateVertex>& SRadialProgressBar::GetLayerVertices(const FRadialLayer& Layer) const
+{
+	return Layer.VertexColor == FColor::White ? Rings[Layer.RingIndex].Vertices : Layer.Vertices;
+}
+
+float SRadialProgressBar::GetMaxRadiusOuter(FVector2f LocalSize) const
+{
+	float MaxRadiusOuter = 0.0f;
+	for (const FRadialRing& Ring : Rings)
+	{
+		float RadiusInner, RadiusOuter;
+		RadialProgressBar::GetRingRadii(Ring.Params, LocalSize, RadiusInner, RadiusOuter);
+		MaxRadiusOuter = FMath::Max(MaxRadiusOuter, RadiusOuter);
+	}
+	return MaxRadiusOuter;
 }
 
 FVector2D SRadialProgressBar::ComputeDesiredSize( float ) const
@@ -185,14 +985,252 @@ void SRadialProgressBar::SetDesiredSizeOverride(TAttribute<TOptional<FVector2D>>
 
 void SRadialProgressBar::SetProgressPercentage(TAttribute<float> InProgressPercentage )
 {
+	StopProgressAnimation();
 	ProgressPercentageAttribute.Assign(*this, MoveTemp(InProgressPercentage));
 }
 
 void SRadialProgressBar::SetProgressPercentage(float InProgressPercentage )
 {
+	StopProgressAnimation();
+
+	// Changes smaller than the threshold are dropped, the next visible change is measured from the last applied value
+	if (!ProgressPercentageAttribute.IsBound(*this) && !IsProgressChangeVisible(ProgressPercentageAttribute.Get(), InProgressPercentage))
+	{
+		INC_DWORD_STAT(STAT_RadialProgressBar_SkippedProgressUpdates);
+		return;
+	}
+
 	ProgressPercentageAttribute.Set(*this, InProgressPercentage);
 }
 
+void SRadialProgressBar::SetLayerProgress(int32 ProgressSource, float InProgressPercentage)
+{
+	if (ProgressSource == 0)
+	{
+		SetProgressPercentage(InProgressPercentage);
+		return;
+	}
+
+	if (!ensure(ProgressSource > 0 && ProgressSource < MaxProgressSources))
+	{
+		return;
+	}
+
+	// No ring is filled by this source, there is nothing to keep
+	if (!bLayersDirty && ProgressSource >= NumProgressSources)
+	{
+		return;
+	}
+
+	if (!IsProgressChangeVisible(GetLayerProgress(ProgressSource), InProgressPercentage))
+	{
+		INC_DWORD_STAT(STAT_RadialProgressBar_SkippedProgressUpdates);
+		return;
+	}
+
+	if (LayerProgress.Num() <= ProgressSource)
+	{
+		LayerProgress.SetNumZeroed(ProgressSource + 1);
+	}
+	LayerProgress[ProgressSource] = InProgressPercentage;
+
+	OnLayerProgressChanged(ProgressSource, InProgressPercentage);
+}
+
+void SRadialProgressBar::AnimateProgressTo(float InTargetPercentage, float InDuration, ERadialProgressEasing InEasing)
+{
+	StopProgressAnimation();
+
+	if (InDuration <= 0.0f)
+	{
+		ProgressPercentageAttribute.Set(*this, InTargetPercentage);
+		OnProgressAnimationFinished.ExecuteIfBound();
+		return;
+	}
+
+	ProgressAnimationStart = ProgressPercentageAttribute.Get();
+	ProgressAnimationTarget = InTargetPercentage;
+	ProgressAnimationDuration = InDuration;
+	ProgressAnimationElapsed = 0.0f;
+	ProgressAnimationEasing = InEasing;
+
+	// The timer only moves the attribute, which repaints the widget when the quantized ring actually changes
+	ProgressAnimationTimer = RegisterActiveTimer(0.0f, FWidgetActiveTimerDelegate::CreateSP(this, &SRadialProgressBar::UpdateProgressAnimation));
+}
+
+void SRadialProgressBar::StopProgressAnimation()
+{
+	if (ProgressAnimationTimer.IsValid())
+	{
+		UnRegisterActiveTimer(ProgressAnimationTimer.ToSharedRef());
+		ProgressAnimationTimer.Reset();
+	}
+}
+
+void SRadialProgressBar::SetOnProgressAnimationFinished(FSimpleDelegate InOnProgressAnimationFinished)
+{
+	OnProgressAnimationFinished = MoveTemp(InOnProgressAnimationFinished);
+}
+
+EActiveTimerReturnType SRadialProgressBar::UpdateProgressAnimation(double InCurrentTime, float InDeltaTime)
+{
+	ProgressAnimationElapsed += InDeltaTime;
+	if (ProgressAnimationElapsed >= ProgressAnimationDuration)
+	{
+		ProgressAnimationTimer.Reset();
+		ProgressPercentageAttribute.Set(*this, ProgressAnimationTarget);
+		OnProgressAnimationFinished.ExecuteIfBound();
+		return EActiveTimerReturnType::Stop;
+	}
+
+	ECurveEaseFunction EaseFunction = ECurveEaseFunction::Linear;
+	switch (ProgressAnimationEasing)
+	{
+	case ERadialProgressEasing::EaseIn:		EaseFunction = ECurveEaseFunction::QuadIn; break;
+	case ERadialProgressEasing::EaseOut:	EaseFunction = ECurveEaseFunction::QuadOut; break;
+	case ERadialProgressEasing::EaseInOut:	EaseFunction = ECurveEaseFunction::QuadInOut; break;
+	default: break;
+	}
+
+	const float Alpha = FCurveHandle::ApplyEasing(ProgressAnimationElapsed / ProgressAnimationDuration, EaseFunction);
+	ProgressPercentageAttribute.Set(*this, FMath::Lerp(ProgressAnimationStart, ProgressAnimationTarget, Alpha));
+
+	return EActiveTimerReturnType::Continue;
+}
+
+float SRadialProgressBar::GetLayerProgress(int32 ProgressSource) const
+{
+	if (ProgressSource == 0)
+	{
+		return ProgressPercentageAttribute.Get();
+	}
+	return LayerProgress.IsValidIndex(ProgressSource) ? LayerProgress[ProgressSource] : 0.0f;
+}
+
+void SRadialProgressBar::SetResolution(int32 InResolution)
+{
+	InResolution = FMath::Clamp(InResolution, RadialMesh::MinResolution, RadialMesh::MaxResolution);
+	if (Resolution != InResolution)
+	{
+		Resolution = InResolution;
+		Invalidate(EInvalidateWidgetReason::Paint);
+	}
+}
+
+void SRadialProgressBar::SetAdaptiveResolution(bool bInAdaptiveResolution, int32 InMinResolution, int32 InMaxResolution, float InMaxChordError)
+{
+	InMinResolution = FMath::Clamp(InMinResolution, RadialMesh::MinResolution, RadialMesh::MaxResolution);
+	InMaxResolution = FMath::Clamp(InMaxResolution, InMinResolution, RadialMesh::MaxResolution);
+	InMaxChordError = FMath::Max(InMaxChordError, KINDA_SMALL_NUMBER);
+	if (bAdaptiveResolution != bInAdaptiveResolution || MinResolution != InMinResolution || MaxResolution != InMaxResolution || MaxChordError != InMaxChordError)
+	{
+		bAdaptiveResolution = bInAdaptiveResolution;
+		MinResolution = InMinResolution;
+		MaxResolution = InMaxResolution;
+		MaxChordError = InMaxChordError;
+
+		AdaptiveResolutionRadius = -1.0f;
+		Invalidate(EInvalidateWidgetReason::Paint);
+	}
+}
+
+void SRadialProgressBar::SetSegments(int32 InSegments, float InSegmentGapAngle)
+{
+	InSegments = FMath::Clamp(InSegments, 0, RadialMesh::MaxResolution);
+	InSegmentGapAngle = FMath::Clamp(InSegmentGapAngle, 0.0f, 360.0f);
+	if (Segments != InSegments || SegmentGapAngle != InSegmentGapAngle)
+	{
+		Segments = InSegments;
+		SegmentGapAngle = InSegmentGapAngle;
+
+		MeshKey = FRadialMeshKey();
+		Invalidate(EInvalidateWidgetReason::Paint);
+	}
+}
+
+void SRadialProgressBar::SetRoundCaps(bool bInRoundCaps)
+{
+	if (bRoundCaps != bInRoundCaps)
+	{
+		bRoundCaps = bInRoundCaps;
+
+		MeshKey = FRadialMeshKey();
+		Invalidate(EInvalidateWidgetReason::Paint);
+	}
+}
+
+void SRadialProgressBar::SetSharedMaterial(bool bInSharedMaterial)
+{
+	if (bSharedMaterial != bInSharedMaterial)
+	{
+		bSharedMaterial = bInSharedMaterial;
+
+		MeshKey = FRadialMeshKey();
+		Invalidate(EInvalidateWidgetReason::Paint);
+	}
+}
+
+void SRadialProgressBar::SetFilledSegments(int32 InFilledSegments)
+{
+	StopProgressAnimation();
+
+	// Whole segments are always a visible change, so this bypasses ProgressChangeThreshold
+	const int32 SegmentCount = FMath::Max(Segments, 1);
+	ProgressPercentageAttribute.Set(*this, FMath::Clamp(InFilledSegments, 0, SegmentCount) * 100.0f / SegmentCount);
+}
+
+void SRadialProgressBar::SetRenderMode(ERadialProgressBarRenderMode InRenderMode)
+{
+	if (RenderMode != InRenderMode)
+	{
+		RenderMode = InRenderMode;
+
+		MeshKey = FRadialMeshKey();
+		Invalidate(EInvalidateWidgetReason::Paint);
+	}
+}
+
+void SRadialProgressBar::SetProgressChangeThreshold(float InProgressChangeThreshold)
+{
+	ProgressChangeThreshold = FMath::Max(InProgressChangeThreshold, 0.0f);
+}
+
+void SRadialProgressBar::SetLayerImageAssetClass(TSubclassOf<ULayerImageAsset> InLayerImageAssetClass)
+{
+	if (LayerImageAssetClass != InLayerImageAssetClass)
+	{
+		LayerImageAssetClass = InLayerImageAssetClass;
+		InvalidateLayers();
+	}
+}
+
+void SRadialProgressBar::SetBarTexture(UTexture2D* InBarTexture)
+{
+	if (BarTexture != InBarTexture)
+	{
+		BarTexture = InBarTexture;
+
+		BarBrush = FSlateBrush();
+		BarBrush.SetResourceObject(BarTexture);
+		BarBrush.DrawAs = ESlateBrushDrawType::Image;
+
+		// Layers falling back to the BarTexture have to be resolved again
+		InvalidateLayers();
+	}
+}
+
+void SRadialProgressBar::SetBatchLayers(bool bInBatchLayers)
+{
+	if (bBatchLayers != bInBatchLayers)
+	{
+		bBatchLayers = bInBatchLayers;
+		CachedLayerBatches.Reset();
+
+		MeshKey = FRadialMeshKey();
+		Invalidate(EInvalidateWidgetReason::Paint);
+	}
+}
+
 
 #if WITH_ACCESSIBILITY
 TSharedRef<FSlateAccessibleWidget> SRadialProgressBar::CreateAccessibleWidget()
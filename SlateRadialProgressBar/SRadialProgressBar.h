@@ -10,9 +10,14 @@
 #include "Styling/CoreStyle.h"
 #include "Widgets/SLeafWidget.h"
 #include "Styling/SlateTypes.h"
+#include "Rendering/RenderingCommon.h"
+#include "RadialProgressBarTypes.h"
+#include "RadialMeshGenerator.h"
 
 class FPaintArgs;
 class FSlateWindowElementList;
+class ULayerImageAsset;
+class UMaterialInstanceDynamic;
 
 /**
  * Implements a widget that displays a progress bar with the desired height, width and progress percentage.
@@ -30,6 +35,18 @@ public:
 		, _FlipForRightToLeftFlowDirection( false )
 		, _LayerImageAssetClass( nullptr )
 		, _BarTexture( nullptr )
+		, _BatchLayers( false )
+		, _RenderMode( ERadialProgressBarRenderMode::Mesh )
+		, _ProgressChangeThreshold( 0.5f )
+		, _Resolution( 16 )
+		, _AdaptiveResolution( false )
+		, _MinResolution( 8 )
+		, _MaxResolution( 128 )
+		, _MaxChordError( 0.25f )
+		, _Segments( 0 )
+		, _SegmentGapAngle( 4.0f )
+		, _RoundCaps( false )
+		, _SharedMaterial( false )
 		{ }
 
 		/** Image resource */
@@ -53,8 +70,45 @@ public:
 		/** Progress Bar Texture */
 		SLATE_ARGUMENT( UTexture2D*, BarTexture)
 
+		/** Merges all layers sharing a resource into a single draw element, carrying each layer's tint in the vertex colour */
+		SLATE_ARGUMENT( bool, BatchLayers )
+
+		/** How the ring is drawn, the SignedDistanceField mode draws one quad per layer and the Material mode one box with the Image brush material */
+		SLATE_ARGUMENT( ERadialProgressBarRenderMode, RenderMode )
+
+		/** Progress changes covering less than this many pixels of arc on screen don't repaint the bar */
+		SLATE_ARGUMENT( float, ProgressChangeThreshold )
+
+		/** Number of segments of a full ring when AdaptiveResolution is off */
+		SLATE_ARGUMENT( int32, Resolution )
+
+		/** Picks the number of segments from the on-screen radius of the ring instead of using Resolution */
+		SLATE_ARGUMENT( bool, AdaptiveResolution )
+
+		/** Bounds of the adaptive number of segments */
+		SLATE_ARGUMENT( int32, MinResolution )
+		SLATE_ARGUMENT( int32, MaxResolution )
+
+		/** Largest distance, in pixels, the adaptive segments may stray from the true circle */
+		SLATE_ARGUMENT( float, MaxChordError )
+
+		/** Splits every ring into this many equal segments separated by gaps, each drawn once the progress fills it completely. 0 or 1 draws a continuous ring. */
+		SLATE_ARGUMENT( int32, Segments )
+
+		/** Angle, in degrees, left empty between two segments */
+		SLATE_ARGUMENT( float, SegmentGapAngle )
+
+		/** Rounds off both ends of partially filled continuous rings with half circles */
+		SLATE_ARGUMENT( bool, RoundCaps )
+
+		/** The Material render mode passes the ring in the vertices of the box instead of dynamic material parameters, so bars sharing the Image brush material batch together */
+		SLATE_ARGUMENT( bool, SharedMaterial )
+
 		/** Invoked when the mouse is pressed in the widget. */
 		SLATE_EVENT(FPointerEventHandler, OnMouseButtonDown)
+
+		/** Invoked when a transition started with AnimateProgressTo reaches its target. */
+		SLATE_EVENT(FSimpleDelegate, OnProgressAnimationFinished)
 	SLATE_END_ARGS()
 
 	/** Constructor */
@@ -69,6 +123,9 @@ public:
 
 public:
 
+	/** Progress sources a bar can have, source 0 included. Layer rings and SetLayerProgress outside of them are ignored. */
+	static constexpr int32 MaxProgressSources = 16;
+
 	/** Set the ColorAndOpacity attribute */
 	void SetColorAndOpacity(TAttribute<FSlateColor> InColorAndOpacity);
 
@@ -87,6 +144,67 @@ public:
 	/** See the ProgressPercentage attribute */
 	void SetProgressPercentage( float InProgressPercentage );
 
+	/**
+	 * Set the progress of a progress source, layers pick theirs with FRadialLayerRing::ProgressSource. Source 0 is the ProgressPercentage.
+	 * Once the layers are resolved, sources none of their rings use are ignored.
+	 */
+	void SetLayerProgress(int32 ProgressSource, float InProgressPercentage);
+
+	/** @return the progress of a progress source, 0 for sources that were never set */
+	float GetLayerProgress(int32 ProgressSource) const;
+
+	/**
+	 * Moves the ProgressPercentage from its current value to the target over the given duration, without any per-frame
+	 * calls from the caller. The widget only repaints when the quantized ring changes. Setting the progress stops the transition.
+	 *
+	 * @param	InTargetPercentage	Progress to end the transition on
+	 * @param	InDuration			Length of the transition in seconds, the target is applied at once when it is not positive
+	 * @param	InEasing			How the progress moves from its current value to the target
+	 */
+	void AnimateProgressTo(float InTargetPercentage, float InDuration, ERadialProgressEasing InEasing = ERadialProgressEasing::Linear);
+
+	/** Stops the running progress transition, leaving the progress where it currently is */
+	void StopProgressAnimation();
+
+	/** @return true while a transition started with AnimateProgressTo is running */
+	bool IsAnimatingProgress() const { return ProgressAnimationTimer.IsValid(); }
+
+	/** Set the delegate invoked when a transition started with AnimateProgressTo reaches its target */
+	void SetOnProgressAnimationFinished(FSimpleDelegate InOnProgressAnimationFinished);
+
+	/** Set the class whose defaults hold the layers of the progress bar */
+	void SetLayerImageAssetClass(TSubclassOf<ULayerImageAsset> InLayerImageAssetClass);
+
+	/** Set the texture the progress bar is drawn with */
+	void SetBarTexture(UTexture2D* InBarTexture);
+
+	/** Set whether all layers sharing a resource are drawn with a single draw element */
+	void SetBatchLayers(bool bInBatchLayers);
+
+	/** Set how the ring is drawn */
+	void SetRenderMode(ERadialProgressBarRenderMode InRenderMode);
+
+	/** Set the minimum on-screen arc length, in pixels, a progress change needs to cover to repaint the bar */
+	void SetProgressChangeThreshold(float InProgressChangeThreshold);
+
+	/** Set the number of segments of a full ring used when adaptive resolution is off */
+	void SetResolution(int32 InResolution);
+
+	/** Set whether the number of segments is picked from the on-screen radius, and the bounds and tolerance used to pick it */
+	void SetAdaptiveResolution(bool bInAdaptiveResolution, int32 InMinResolution, int32 InMaxResolution, float InMaxChordError);
+
+	/** Set the number of separate segments the rings are split into, and the gap between them in degrees. Segments are only drawn by the Mesh render mode. */
+	void SetSegments(int32 InSegments, float InSegmentGapAngle);
+
+	/** Set whether both ends of partially filled continuous rings are rounded off. Caps are only drawn by the Mesh render mode. */
+	void SetRoundCaps(bool bInRoundCaps);
+
+	/** Set whether the Material render mode passes the ring in the vertices of the box, leaving the Image brush material shared, instead of setting it on a dynamic material */
+	void SetSharedMaterial(bool bInSharedMaterial);
+
+	/** Set the progress so exactly the given number of segments is filled, regardless of ProgressChangeThreshold */
+	void SetFilledSegments(int32 InFilledSegments);
+
 public:
 
 	// SWidget overrides
@@ -100,6 +218,177 @@ protected:
 	virtual FVector2D ComputeDesiredSize(float) const override;
 	// End SWidget overrides.
 
+	/** Everything the ring meshes depend on. The cached meshes are re-submitted as long as this does not change. */
+	struct FRadialMeshKey
+	{
+		FVector2f LocalSize = FVector2f::ZeroVector;
+		FSlateRenderTransform RenderTransform;
+		int32 Resolution = 0;
+
+		/** Quantized progress of every progress source used by the layers, indexed by source */
+		TArray<int32, TInlineAllocator<4>> QuantizedProgress;
+
+		/** @return true when both keys lay the rings out identically in local space, wherever they are on screen and whatever their progress */
+		bool HasSameLocalGeometry(const FRadialMeshKey& Other) const
+		{
+			return LocalSize == Other.LocalSize
+				&& Resolution == Other.Resolution;
+		}
+
+		bool operator==(const FRadialMeshKey& Other) const
+		{
+			return HasSameLocalGeometry(Other)
+				&& RenderTransform == Other.RenderTransform
+				&& QuantizedProgress == Other.QuantizedProgress;
+		}
+	};
+
+	/** Number of discrete progress steps the mesh is built for, progress changes smaller than one step reuse the cached mesh. */
+	static constexpr int32 ProgressQuantizationSteps = 1000;
+
+	/** @return the number of segments of a full ring whose outer edge has the given on-screen radius */
+	int32 ComputeResolution(float OnScreenRadius) const;
+
+	/** @return the progress step the mesh is built for */
+	int32 QuantizeProgress(float InProgressPercentage) const;
+
+	/** @return true when going from one progress to the other moves the end of the ring by at least ProgressChangeThreshold pixels */
+	bool IsProgressChangeVisible(float FromPercentage, float ToPercentage) const;
+
+	/** Repaints the widget when a new progress value changes the quantized ring. */
+	void OnProgressPercentageChanged();
+
+	/** Repaints the widget when the new progress of a source changes the quantized rings filled by it. */
+	void OnLayerProgressChanged(int32 ProgressSource, float NewProgressPercentage);
+
+	/** Active timer advancing the progress transition, see AnimateProgressTo. */
+	EActiveTimerReturnType UpdateProgressAnimation(double InCurrentTime, float InDeltaTime);
+
+	/** A distinct ring drawn by one or more layers, and its cached mesh. */
+	struct FRadialRing
+	{
+		FRadialLayerRing Params;
+
+		/** Progress step the mesh was built for */
+		int32 QuantizedProgress = INDEX_NONE;
+
+		/** Local-space arc, independent of the render transform: the directions of its vertex pairs, of every segment when segmented, and its rounded caps */
+		TArray<RadialMesh::FPoint> Directions;
+		TArray<FSlateVertex> LocalCapVertices;
+
+		/** Mesh in render space */
+		TArray<FSlateVertex> Vertices;
+
+		/** Shared index list of the mesh, null while the ring is empty */
+		const TArray<SlateIndex>* Indices = nullptr;
+
+		/** Bumped every time the mesh changes, so layers know when to copy it again */
+		int32 Revision = 0;
+
+		/** Every segment of a segmented ring in render space, the mesh is the prefix of the filled ones */
+		TArray<FSlateVertex> SegmentVertices;
+		int32 PairsPerSegment = 0;
+		int32 FilledSegments = INDEX_NONE;
+	};
+
+	/** Regenerates the local-space arc of a ring and its index list for the given key. */
+	void TessellateRing(FRadialRing& Ring, const FRadialMeshKey& Key) const;
+
+	/** Regenerates the local-space arcs of every segment of a segmented ring for the given key, filled or not. */
+	void TessellateSegments(FRadialRing& Ring, const FRadialMeshKey& Key) const;
+
+	/** Applies the render transform of the key to the local-space arc of a ring in a single pass. */
+	void TransformRing(const FRadialRing& Ring, const FRadialMeshKey& Key, TArray<FSlateVertex>& OutVertices) const;
+
+	/** Points the mesh of a segmented ring at the segments filled by the given progress, without generating any geometry. */
+	void ApplySegmentFill(FRadialRing& Ring, int32 QuantizedProgress) const;
+
+	/** Tessellates the rings whose progress or local geometry changed, and transforms them again when they or the transform changed. */
+	void RebuildMesh(const FRadialMeshKey& Key, bool bLocalGeometryChanged, bool bTransformChanged) const;
+
+	/** @return the largest outer radius of all rings, in slate units, for the given allotted size */
+	float GetMaxRadiusOuter(FVector2f LocalSize) const;
+
+	/** A layer of the LayerImageAsset, resolved into what painting it needs. */
+	struct FRadialLayer
+	{
+		const UObject* ResourceObject = nullptr;
+		FSlateResourceHandle ResourceHandle;
+		FColor Tint = FColor::White;
+
+		/** Index of the ring the layer is drawn on in the Rings table */
+		int32 RingIndex = 0;
+
+		/** Copy of the ring mesh carrying the layer and widget colour, unused while that colour is white */
+		TArray<FSlateVertex> Vertices;
+		FColor VertexColor = FColor::White;
+
+		/** Revision of the ring the copy was made from */
+		int32 RingRevision = INDEX_NONE;
+	};
+
+	/** Copies the rings of the layers whose ring or colour changed, multiplied by their colour. No geometry is generated. */
+	void UpdateLayerVertexColors() const;
+
+	/** @return the vertices to submit for a layer */
+	const TArray<FSlateVertex>& GetLayerVertices(const FRadialLayer& Layer) const;
+
+	/** Resolves the layers of the LayerImageAsset, or a single default layer when there is none, into the Layers and Rings tables. */
+	void ResolveLayers() const;
+
+	/** Resolves the layers again on the next paint and rebuilds the meshes depending on them. */
+	void InvalidateLayers();
+
+#if WITH_EDITOR
+	/** Picks up edits made to the layer asset in the editor. */
+	void HandleLayerImageAssetChanged(const ULayerImageAsset* ChangedAsset);
+#endif
+
+	/** All layers drawn with the same resource, merged into a single vertex/index buffer. */
+	struct FRadialLayerBatch
+	{
+		const UObject* ResourceObject = nullptr;
+		FSlateResourceHandle ResourceHandle;
+		TArray<FSlateVertex> Vertices;
+		TArray<SlateIndex> Indices;
+	};
+
+	/** Merges the cached ring of every layer into one batch per resource. */
+	void RebuildLayerBatches() const;
+
+	/** Regenerates the cached quad buffers as one analytic ring quad per layer, see FRadialRingSDF. */
+	void RebuildSignedDistanceFieldQuads(const FRadialMeshKey& Key) const;
+
+	/** @return the material resource of the Image brush, used by the SignedDistanceField render mode and the shared Material render mode */
+	FSlateResourceHandle GetSignedDistanceFieldResourceHandle() const;
+
+	/** Ring of the first layer as the parameters of the Material render mode, see FRadialRingSDF. */
+	struct FRadialMaterialParameters
+	{
+		float Progress = 0.0f;
+		float InnerRatio = 0.0f;
+		FVector2f RingExtent = FVector2f::ZeroVector;
+		FVector4f RingFrame = FVector4f(1.0f, 0.0f, 1.0f, 1.0f);
+
+		bool operator==(const FRadialMaterialParameters& Other) const
+		{
+			return Progress == Other.Progress
+				&& InnerRatio == Other.InnerRatio
+				&& RingExtent == Other.RingExtent
+				&& RingFrame == Other.RingFrame;
+		}
+	};
+
+	/** Computes the parameters of the Material render mode for the given key. */
+	void RebuildMaterialParameters(const FRadialMeshKey& Key) const;
+
+	/** Sets the parameters on the dynamic material of the Image brush, when they or the material changed since they were last set. */
+	void ApplyMaterialParameters(const FSlateBrush& ImageBrush) const;
+
+	/** Regenerates the cached quad buffers as one box carrying the parameters in its vertices, for a shared material. */
+	void RebuildMaterialBoxQuad(const FRadialMeshKey& Key, FColor BoxColor) const;
+
+
 	/** @return an attribute reference of Image */
 	TSlateAttributeRef<const FSlateBrush*> GetImageAttribute() const { return TSlateAttributeRef<FSlateBrush const*>(SharedThis(this), ImageAttribute); }
 
@@ -141,4 +430,89 @@ protected:
 	TSubclassOf<class ULayerImageAsset> LayerImageAssetClass; 
 
 	UTexture2D* BarTexture;
+
+	/** Brush wrapping the BarTexture, used to resolve the resource of layers without their own */
+	FSlateBrush BarBrush;
+
+	/** Draw all layers sharing a resource with a single draw element */
+	bool bBatchLayers;
+
+	/** How the ring is drawn */
+	ERadialProgressBarRenderMode RenderMode;
+
+	/** Minimum on-screen arc length, in pixels, a progress change needs to cover to repaint the bar */
+	float ProgressChangeThreshold;
+
+	/** Number of segments of a full ring when bAdaptiveResolution is off */
+	int32 Resolution;
+
+	/** Picks the number of segments from the on-screen radius, between MinResolution and MaxResolution, so chords stay within MaxChordError pixels */
+	bool bAdaptiveResolution;
+	int32 MinResolution;
+	int32 MaxResolution;
+	float MaxChordError;
+
+	/** Number of separate segments of every ring, 0 or 1 for continuous rings, and the angle between two segments in degrees */
+	int32 Segments;
+	float SegmentGapAngle;
+
+	/** Rounds off both ends of partially filled continuous rings */
+	bool bRoundCaps;
+
+	/** The Material render mode passes the ring in the vertices of the box, the Image brush material stays shared between bars */
+	bool bSharedMaterial;
+
+private:
+	/** Key the cached mesh was built for */
+	mutable FRadialMeshKey MeshKey;
+
+	/** On-screen length of the outer circle of the cached mesh, in pixels */
+	mutable float MeshCircumference;
+
+	/** Widget colour and opacity the cached vertex colours were computed with */
+	mutable FColor MeshPaintColor;
+
+	/** On-screen radius the adaptive resolution was last computed for, and its result */
+	mutable float AdaptiveResolutionRadius;
+	mutable int32 AdaptiveResolution;
+
+	/** Cached SignedDistanceField quads of all layers, or box of the shared Material render mode, only rebuilt when MeshKey changes */
+	mutable TArray<FSlateVertex> CachedVertices;
+	mutable TArray<SlateIndex> CachedIndices;
+
+	/** Paint-ready layer table, resolved on the first paint after the layer asset or the BarTexture changed */
+	mutable TArray<FRadialLayer> Layers;
+	mutable bool bLayersDirty;
+
+	/** Distinct rings of the layers with their cached meshes, resolved along with the layers */
+	mutable TArray<FRadialRing> Rings;
+
+	/** Number of progress sources used by the rings */
+	mutable int32 NumProgressSources;
+
+	/** Progress of every progress source other than 0, indexed by source */
+	TArray<float> LayerProgress;
+
+	/** Running progress transition, see AnimateProgressTo */
+	TSharedPtr<FActiveTimerHandle> ProgressAnimationTimer;
+	float ProgressAnimationStart;
+	float ProgressAnimationTarget;
+	float ProgressAnimationDuration;
+	float ProgressAnimationElapsed;
+	ERadialProgressEasing ProgressAnimationEasing;
+
+	/** Invoked when a progress transition reaches its target */
+	FSimpleDelegate OnProgressAnimationFinished;
+
+	/** Image brush resource the SignedDistanceField handle was resolved for, and the handle */
+	mutable TWeakObjectPtr<const UObject> SignedDistanceFieldResourceObject;
+	mutable FSlateResourceHandle SignedDistanceFieldResourceHandle;
+
+	/** Parameters of the Material render mode for MeshKey, and the ones last set on the dynamic material of the Image brush */
+	mutable FRadialMaterialParameters MaterialParameters;
+	mutable FRadialMaterialParameters AppliedMaterialParameters;
+	mutable TWeakObjectPtr<UMaterialInstanceDynamic> AppliedMaterial;
+
+	/** Cached per-resource layer batches, only used when bBatchLayers is set */
+	mutable TArray<FRadialLayerBatch> CachedLayerBatches;
 };
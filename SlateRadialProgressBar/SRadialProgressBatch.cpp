@@ -0,0 +1,199 @@
+#include "SRadialProgressBatch.h"
+#include "RadialMeshGenerator.h"
+#include "RadialRingVertexKernel.h"
+#include "RadialProgressBarStats.h"
+#include "Rendering/DrawElements.h"
+#include "Framework/Application/SlateApplication.h"
+#include "Engine/Texture2D.h"
+
+
+SLATE_IMPLEMENT_WIDGET(SRadialProgressBatch)
+void SRadialProgressBatch::PrivateRegisterAttributes(FSlateAttributeInitializer& AttributeInitializer)
+{
+}
+
+SRadialProgressBatch::SRadialProgressBatch()
+	: Resolution(16)
+	, BarTexture(nullptr)
+	, bResourceHandleDirty(true)
+	, bMeshDirty(true)
+{
+	SetCanTick(false);
+	bCanSupportFocus = false;
+}
+
+void SRadialProgressBatch::Construct( const FArguments& InArgs )
+{
+	Resolution = FMath::Clamp(InArgs._Resolution, RadialMesh::MinResolution, RadialMesh::MaxResolution);
+	SetBarTexture(InArgs._BarTexture);
+}
+
+int32 SRadialProgressBatch::AddEntry(FVector2f Center, float RadiusInner, float RadiusOuter, float ProgressPercentage, FLinearColor Color)
+{
+	const int32 Index = Centers.Add(Center);
+	RadiiInner.Add(RadiusInner);
+	RadiiOuter.Add(RadiusOuter);
+	Progresses.Add(FMath::Clamp(ProgressPercentage, 0.0f, 100.0f));
+	Colors.Add(Color.ToFColor(true));
+
+	MarkMeshDirty(EInvalidateWidgetReason::Layout);
+	return Index;
+}
+
+void SRadialProgressBatch::RemoveEntryAtSwap(int32 Index)
+{
+	if (Centers.IsValidIndex(Index))
+	{
+		Centers.RemoveAtSwap(Index);
+		RadiiInner.RemoveAtSwap(Index);
+		RadiiOuter.RemoveAtSwap(Index);
+		Progresses.RemoveAtSwap(Index);
+		Colors.RemoveAtSwap(Index);
+
+		MarkMeshDirty(EInvalidateWidgetReason::Layout);
+	}
+}
+
+void SRadialProgressBatch::ClearEntries()
+{
+	Centers.Reset();
+	RadiiInner.Reset();
+	RadiiOuter.Reset();
+	Progresses.Reset();
+	Colors.Reset();
+
+	MarkMeshDirty(EInvalidateWidgetReason::Layout);
+}
+
+void SRadialProgressBatch::SetEntryCenter(int32 Index, FVector2f InCenter)
+{
+	if (Centers.IsValidIndex(Index) && Centers[Index] != InCenter)
+	{
+		Centers[Index] = InCenter;
+		MarkMeshDirty(EInvalidateWidgetReason::Layout);
+	}
+}
+
+void SRadialProgressBatch::SetEntryRadii(int32 Index, float InRadiusInner, float InRadiusOuter)
+{
+	if (Centers.IsValidIndex(Index) && (RadiiInner[Index] != InRadiusInner || RadiiOuter[Index] != InRadiusOuter))
+	{
+		RadiiInner[Index] = InRadiusInner;
+		RadiiOuter[Index] = InRadiusOuter;
+		MarkMeshDirty(EInvalidateWidgetReason::Layout);
+	}
+}
+
+void SRadialProgressBatch::SetEntryProgress(int32 Index, float InProgressPercentage)
+{
+	InProgressPercentage = FMath::Clamp(InProgressPercentage, 0.0f, 100.0f);
+	if (Centers.IsValidIndex(Index) && Progresses[Index] != InProgressPercentage)
+	{
+		Progresses[Index] = InProgressPercentage;
+		MarkMeshDirty();
+	}
+}
+
+void SRadialProgressBatch::SetEntryColor(int32 Index, FLinearColor InColor)
+{
+	const FColor Color = InColor.ToFColor(true);
+	if (Centers.IsValidIndex(Index) && Colors[Index] != Color)
+	{
+		Colors[Index] = Color;
+		MarkMeshDirty();
+	}
+}
+
+void SRadialProgressBatch::SetBarTexture(UTexture2D* InBarTexture)
+{
+	BarTexture = InBarTexture;
+	BarBrush = FSlateBrush();
+	BarBrush.SetResourceObject(BarTexture);
+	BarBrush.DrawAs = ESlateBrushDrawType::Image;
+
+	bResourceHandleDirty = true;
+	Invalidate(EInvalidateWidgetReason::Paint);
+}
+
+void SRadialProgressBatch::MarkMeshDirty(EInvalidateWidgetReason Reason)
+{
+	bMeshDirty = true;
+	Invalidate(Reason);
+}
+
+int32 SRadialProgressBatch::OnPaint( const FPaintArgs& Args, const FGeometry& AllottedGeometry, const FSlateRect& MyCullingRect, FSlateWindowElementList& OutDrawElements, int32 LayerId, const FWidgetStyle& InWidgetStyle, bool bParentEnabled ) const
+{
+	if (!BarTexture || Centers.Num() == 0)
+	{
+		return LayerId;
+	}
+
+	if (bResourceHandleDirty)
+	{
+		BarResourceHandle = FSlateApplication::Get().GetRenderer()->GetResourceHandle(BarBrush);
+		bResourceHandleDirty = false;
+	}
+
+	const FSlateRenderTransform& RenderTransform = AllottedGeometry.GetAccumulatedRenderTransform();
+	if (bMeshDirty || !(RenderTransform == MeshRenderTransform))
+	{
+		RebuildMesh(RenderTransform);
+	}
+
+	if (BarResourceHandle.IsValid() && Indices.Num() > 0)
+	{
+		FSlateDrawElement::MakeCustomVerts(OutDrawElements, LayerId, BarResourceHandle, Vertices, Indices, nullptr, 0, 0);
+	}
+
+	return LayerId;
+}
+
+void SRadialProgressBatch::RebuildMesh(const FSlateRenderTransform& RenderTransform) const
+{
+	MeshRenderTransform = RenderTransform;
+	bMeshDirty = false;
+
+	Vertices.Reset();
+	Indices.Reset();
+
+	const FVector2f TexCoord = {0, 0};
+
+	// Worst case is every ring fully covered, reserve it once so the loop never grows the buffers
+	RadialProgressBar::ReserveMeshBuffer(Vertices, Centers.Num() * RadialMesh::GetMaxPairCount(Resolution) * 2);
+	RadialProgressBar::ReserveMeshBuffer(Indices, Centers.Num() * (RadialMesh::GetMaxPairCount(Resolution) - 1) * 6);
+
+	RadialMesh::FArcParams Arc;
+	Arc.Resolution = Resolution;
+
+	RadialMesh::FPoint Directions[RadialMesh::MaxPairCount];
+
+	const int32 NumEntries = Centers.Num();
+	for (int32 EntryIndex = 0; EntryIndex < NumEntries; ++EntryIndex)
+	{
+		Arc.SweepFraction = Progresses[EntryIndex] / 100.0f;
+
+		const int32 NumPairs = RadialMesh::GenerateArcDirections(Arc, Directions);
+		if (NumPairs < 2)
+		{
+			continue;
+		}
+
+		const FSlateVertex Template = FSlateVertex::Make<ESlateVertexRounding::Disabled>(RenderTransform, Centers[EntryIndex], TexCoord, TexCoord, Colors[EntryIndex]);
+		const SlateIndex BaseIndex = (SlateIndex)Vertices.Num();
+		Vertices.AddUninitialized(NumPairs * 2);
+		RadialProgressBar::TransformRingVertices(Directions, NumPairs, Centers[EntryIndex], RadiiInner[EntryIndex], RadiiOuter[EntryIndex], RenderTransform, Template, Template, Vertices.GetData() + BaseIndex);
+
+		const int32 FirstIndex = Indices.AddUninitialized((NumPairs - 1) * 6);
+		RadialMesh::GenerateArcIndices<SlateIndex>(NumPairs, BaseIndex, Indices.GetData() + FirstIndex);
+	}
+}
+
+FVector2D SRadialProgressBatch::ComputeDesiredSize( float ) const
+{
+	FVector2f DesiredSize = FVector2f::ZeroVector;
+	for (int32 EntryIndex = 0; EntryIndex < Centers.Num(); ++EntryIndex)
+	{
+		DesiredSize = FVector2f::Max(DesiredSize, Centers[EntryIndex] + FVector2f(RadiiOuter[EntryIndex]));
+	}
+	return FVector2D(DesiredSize);
+}
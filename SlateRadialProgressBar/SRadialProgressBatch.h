@@ -0,0 +1,125 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Widgets/DeclarativeSyntaxSupport.h"
+#include "Widgets/SLeafWidget.h"
+#include "Styling/SlateBrush.h"
+#include "Rendering/RenderingCommon.h"
+
+class FPaintArgs;
+class FSlateWindowElementList;
+class UTexture2D;
+
+/**
+ * Draws many radial progress rings in a single paint.
+ * Each ring is a light entry (centre, radii, progress, colour) stored as a structure of arrays instead of a full
+ * SRadialProgressBar, and all of them are written into shared vertex/index buffers submitted as one draw element.
+ */
+class TANKMAYHEM_API SRadialProgressBatch
+	: public SLeafWidget
+{
+	SLATE_DECLARE_WIDGET(SRadialProgressBatch, SLeafWidget)
+
+public:
+	SLATE_BEGIN_ARGS( SRadialProgressBatch )
+		: _BarTexture( nullptr )
+		, _Resolution( 16 )
+		{ }
+
+		/** Texture every ring is drawn with */
+		SLATE_ARGUMENT( UTexture2D*, BarTexture )
+
+		/** Number of segments of a full ring */
+		SLATE_ARGUMENT( int32, Resolution )
+	SLATE_END_ARGS()
+
+	/** Constructor */
+	SRadialProgressBatch();
+
+	/**
+	 * Construct this widget
+	 *
+	 * @param	InArgs	The declaration data for this widget
+	 */
+	void Construct( const FArguments& InArgs );
+
+public:
+
+	/**
+	 * Adds a ring to the batch
+	 *
+	 * @param	Center				Centre of the ring in the local space of this widget
+	 * @param	RadiusInner			Radius of the inner edge of the ring
+	 * @param	RadiusOuter			Radius of the outer edge of the ring
+	 * @param	ProgressPercentage	Progress in [0, 100]
+	 * @param	Color				Colour of the ring
+	 * @return	the index of the new entry
+	 */
+	int32 AddEntry(FVector2f Center, float RadiusInner, float RadiusOuter, float ProgressPercentage, FLinearColor Color);
+
+	/** Removes an entry, the last entry is moved into its index. */
+	void RemoveEntryAtSwap(int32 Index);
+
+	/** Removes all entries */
+	void ClearEntries();
+
+	/** @return the number of rings in the batch */
+	int32 NumEntries() const { return Centers.Num(); }
+
+	/** Set the centre of an entry */
+	void SetEntryCenter(int32 Index, FVector2f InCenter);
+
+	/** Set the inner and outer radius of an entry */
+	void SetEntryRadii(int32 Index, float InRadiusInner, float InRadiusOuter);
+
+	/** Set the progress percentage of an entry */
+	void SetEntryProgress(int32 Index, float InProgressPercentage);
+
+	/** Set the colour of an entry */
+	void SetEntryColor(int32 Index, FLinearColor InColor);
+
+	/** Set the texture every ring is drawn with */
+	void SetBarTexture(UTexture2D* InBarTexture);
+
+public:
+
+	// SWidget overrides
+	virtual int32 OnPaint( const FPaintArgs& Args, const FGeometry& AllottedGeometry, const FSlateRect& MyCullingRect, FSlateWindowElementList& OutDrawElements, int32 LayerId, const FWidgetStyle& InWidgetStyle, bool bParentEnabled ) const override;
+
+protected:
+	// Begin SWidget overrides.
+	virtual FVector2D ComputeDesiredSize(float) const override;
+	// End SWidget overrides.
+
+private:
+	/** Marks the shared buffers for regeneration and repaints the widget. */
+	void MarkMeshDirty(EInvalidateWidgetReason Reason = EInvalidateWidgetReason::Paint);
+
+	/** Regenerates the shared vertex/index buffers for every entry. */
+	void RebuildMesh(const FSlateRenderTransform& RenderTransform) const;
+
+private:
+	/** Per entry data, one element per ring in every array */
+	TArray<FVector2f> Centers;
+	TArray<float> RadiiInner;
+	TArray<float> RadiiOuter;
+	TArray<float> Progresses;
+	TArray<FColor> Colors;
+
+	/** Number of segments of a full ring */
+	int32 Resolution;
+
+	/** Texture every ring is drawn with, and the brush used to resolve its resource handle */
+	UTexture2D* BarTexture;
+	FSlateBrush BarBrush;
+
+	/** Resource handle of BarBrush, resolved on the first paint after the texture changed */
+	mutable FSlateResourceHandle BarResourceHandle;
+	mutable bool bResourceHandleDirty;
+
+	/** Shared buffers holding every ring, rebuilt when an entry or the render transform changed */
+	mutable TArray<FSlateVertex> Vertices;
+	mutable TArray<SlateIndex> Indices;
+	mutable FSlateRenderTransform MeshRenderTransform;
+	mutable bool bMeshDirty;
+};
@@ -0,0 +1,63 @@
+#include "CoreMinimal.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Misc/AutomationTest.h"
+#include "RadialRingSDF.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRadialRingSDFTest, "RadialProgressBar.SignedDistanceField", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FRadialRingSDFTest::RunTest(const FString& Parameters)
+{
+	const float InnerRatio = 0.5f;
+	const float MidRadius = 0.75f;
+	const float PixelWidth = 0.01f;
+	const float Tolerance = 1.0e-4f;
+
+	const auto AtAngle = [](float Radius, float Angle)
+	{
+		float Sin, Cos;
+		FMath::SinCos(&Sin, &Cos, Angle);
+		return FVector2f(Cos, Sin) * Radius;
+	};
+
+	// Inside the covered part of the ring
+	const FVector2f Inside = AtAngle(MidRadius, UE_PI * 0.25f);
+	TestTrue(TEXT("Inside is negative"), FRadialRingSDF::Distance(Inside, InnerRatio, 0.5f) < 0.0f);
+	TestEqual(TEXT("Inside is covered"), FRadialRingSDF::Coverage(Inside, InnerRatio, 0.5f, PixelWidth), 1.0f);
+
+	// Outside the ring, beyond its outer edge, in its hole and past the end of the sweep
+	for (const FVector2f& Outside : { AtAngle(1.2f, UE_PI * 0.25f), AtAngle(0.2f, UE_PI * 0.25f), AtAngle(MidRadius, UE_PI * 1.5f) })
+	{
+		TestTrue(TEXT("Outside is positive"), FRadialRingSDF::Distance(Outside, InnerRatio, 0.5f) > 0.0f);
+		TestEqual(TEXT("Outside is not covered"), FRadialRingSDF::Coverage(Outside, InnerRatio, 0.5f, PixelWidth), 0.0f);
+	}
+
+	// Edges are half covered: the inner and outer edge, the start of the sweep on +X and its end
+	const FVector2f InnerEdge = AtAngle(InnerRatio, UE_PI * 0.25f);
+	const FVector2f OuterEdge = AtAngle(1.0f, UE_PI * 0.25f);
+	const FVector2f SweepStart = AtAngle(MidRadius, 0.0f);
+	const FVector2f SweepEnd = AtAngle(MidRadius, UE_PI);
+	for (const FVector2f& Edge : { InnerEdge, OuterEdge, SweepStart, SweepEnd })
+	{
+		TestEqual(TEXT("Edge distance"), FRadialRingSDF::Distance(Edge, InnerRatio, 0.5f), 0.0f, Tolerance);
+		TestEqual(TEXT("Edge coverage"), FRadialRingSDF::Coverage(Edge, InnerRatio, 0.5f, PixelWidth), 0.5f, 0.01f);
+	}
+
+	// Distances to the end of the sweep are measured along the arc
+	const FVector2f PastSweepEnd = AtAngle(MidRadius, UE_PI + 0.1f);
+	TestEqual(TEXT("Distance past the sweep"), FRadialRingSDF::Distance(PastSweepEnd, InnerRatio, 0.5f), 0.1f * MidRadius, Tolerance);
+
+	// 0% covers nothing, 100% covers the whole ring whatever the angle, right up to the start of the sweep
+	for (const float Angle : { 0.0f, UE_PI * 0.5f, UE_PI, UE_TWO_PI - 0.001f })
+	{
+		const FVector2f Position = AtAngle(MidRadius, Angle);
+		TestEqual(TEXT("0% coverage"), FRadialRingSDF::Coverage(Position, InnerRatio, 0.0f, PixelWidth), 0.0f);
+		TestEqual(TEXT("100% coverage"), FRadialRingSDF::Coverage(Position, InnerRatio, 1.0f, PixelWidth), 1.0f);
+	}
+	TestEqual(TEXT("100% leaves the hole empty"), FRadialRingSDF::Coverage(AtAngle(0.2f, 1.0f), InnerRatio, 1.0f, PixelWidth), 0.0f);
+
+	return true;
+}
+
+#endif
@@ -0,0 +1,116 @@
+#include "CoreMinimal.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Misc/AutomationTest.h"
+#include "Math/RandomStream.h"
+#include "HAL/PlatformTime.h"
+#include "RadialRingVertexKernel.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRadialRingVertexKernelTest, "RadialProgressBar.VertexKernel", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FRadialRingVertexKernelTest::RunTest(const FString& Parameters)
+{
+	// Compares the kernel with transforming every vertex through the render transform, and with its scalar fallback to the bit,
+	// over random transforms and directions
+	FRandomStream Random(0x52504221);
+
+	FSlateVertex InnerTemplate = FSlateVertex::Make<ESlateVertexRounding::Disabled>(FSlateRenderTransform(), FVector2f::ZeroVector, FVector4f(0.1f, 0.2f, 0.3f, 0.4f), FVector2f(0.5f, 0.6f), FColor::White);
+	FSlateVertex OuterTemplate = FSlateVertex::Make<ESlateVertexRounding::Disabled>(FSlateRenderTransform(), FVector2f::ZeroVector, FVector4f(0.7f, 0.8f, 0.9f, 1.0f), FVector2f(1.1f, 1.2f), FColor::Red);
+
+	for (int32 Iteration = 0; Iteration < 256; ++Iteration)
+	{
+		const FMatrix2x2f Matrix(Random.FRandRange(-4.0f, 4.0f), Random.FRandRange(-4.0f, 4.0f), Random.FRandRange(-4.0f, 4.0f), Random.FRandRange(-4.0f, 4.0f));
+		const FSlateRenderTransform RenderTransform(Matrix, FVector2f(Random.FRandRange(-2000.0f, 2000.0f), Random.FRandRange(-2000.0f, 2000.0f)));
+		const FVector2f Center(Random.FRandRange(0.0f, 512.0f), Random.FRandRange(0.0f, 512.0f));
+		const float RadiusOuter = Random.FRandRange(1.0f, 256.0f);
+		const float RadiusInner = Random.FRandRange(0.0f, RadiusOuter);
+
+		// Odd and even counts, including none
+		const int32 NumDirections = Random.RandRange(0, RadialMesh::MaxPairCount);
+		TArray<RadialMesh::FPoint> Directions;
+		for (int32 Index = 0; Index < NumDirections; ++Index)
+		{
+			float Sin, Cos;
+			FMath::SinCos(&Sin, &Cos, Random.FRandRange(0.0f, UE_TWO_PI));
+			Directions.Add({ Cos, Sin });
+		}
+
+		TArray<FSlateVertex> Vertices;
+		Vertices.SetNumZeroed(NumDirections * 2);
+		RadialProgressBar::TransformRingVertices(Directions.GetData(), NumDirections, Center, RadiusInner, RadiusOuter, RenderTransform, InnerTemplate, OuterTemplate, Vertices.GetData());
+
+		TArray<FSlateVertex> ScalarVertices;
+		ScalarVertices.SetNumZeroed(NumDirections * 2);
+		RadialProgressBar::TransformRingVerticesScalar(Directions.GetData(), NumDirections, Center, RadiusInner, RadiusOuter, RenderTransform, InnerTemplate, OuterTemplate, ScalarVertices.GetData());
+
+		if (FMemory::Memcmp(Vertices.GetData(), ScalarVertices.GetData(), Vertices.Num() * sizeof(FSlateVertex)) != 0)
+		{
+			AddError(FString::Printf(TEXT("Iteration %d: the kernel and its scalar fallback wrote different vertices for %d directions"), Iteration, NumDirections));
+			return false;
+		}
+
+		const float Tolerance = 1.0e-5f * (FMath::Abs(RenderTransform.GetTranslation().X) + FMath::Abs(RenderTransform.GetTranslation().Y) + 16.0f * (512.0f + RadiusOuter));
+		for (int32 Index = 0; Index < NumDirections; ++Index)
+		{
+			const FVector2f Direction(Directions[Index].X, Directions[Index].Y);
+			for (int32 Side = 0; Side < 2; ++Side)
+			{
+				const FSlateVertex& Vertex = Vertices[Index * 2 + Side];
+				const FSlateVertex& Template = Side == 0 ? InnerTemplate : OuterTemplate;
+				const FVector2f Expected = RenderTransform.TransformPoint(Center + Direction * (Side == 0 ? RadiusInner : RadiusOuter));
+
+				if (!Vertex.Position.Equals(Expected, Tolerance))
+				{
+					AddError(FString::Printf(TEXT("Iteration %d, vertex %d: (%f, %f) instead of (%f, %f)"), Iteration, Index * 2 + Side, Vertex.Position.X, Vertex.Position.Y, Expected.X, Expected.Y));
+					return false;
+				}
+
+				// Everything but the position is copied from the template as it is
+				FSlateVertex Unpositioned = Vertex;
+				Unpositioned.Position = Template.Position;
+				if (FMemory::Memcmp(&Unpositioned, &Template, sizeof(FSlateVertex)) != 0)
+				{
+					AddError(FString::Printf(TEXT("Iteration %d, vertex %d does not match its template"), Iteration, Index * 2 + Side));
+					return false;
+				}
+			}
+		}
+	}
+
+	// Times both paths on a full ring of the highest resolution, the figures are reported with the test
+	{
+		const int32 NumDirections = RadialMesh::MaxPairCount;
+		const int32 NumRepeats = 10000;
+
+		TArray<RadialMesh::FPoint> Directions;
+		for (int32 Index = 0; Index < NumDirections; ++Index)
+		{
+			float Sin, Cos;
+			FMath::SinCos(&Sin, &Cos, Index * UE_TWO_PI / (NumDirections - 1));
+			Directions.Add({ Cos, Sin });
+		}
+
+		TArray<FSlateVertex> Vertices;
+		Vertices.SetNumZeroed(NumDirections * 2);
+		const FSlateRenderTransform RenderTransform(FMatrix2x2f(1.5f, 0.25f, -0.25f, 1.5f), FVector2f(100.0f, 200.0f));
+
+		double Seconds[2];
+		for (int32 Path = 0; Path < 2; ++Path)
+		{
+			const double StartTime = FPlatformTime::Seconds();
+			for (int32 Repeat = 0; Repeat < NumRepeats; ++Repeat)
+			{
+				(Path == 0 ? RadialProgressBar::TransformRingVertices : RadialProgressBar::TransformRingVerticesScalar)(Directions.GetData(), NumDirections, FVector2f(64.0f, 64.0f), 48.0f, 64.0f, RenderTransform, InnerTemplate, OuterTemplate, Vertices.GetData());
+			}
+			Seconds[Path] = FPlatformTime::Seconds() - StartTime;
+		}
+
+		AddInfo(FString::Printf(TEXT("%d directions: %.1f ns per ring with TransformRingVertices, %.1f ns with TransformRingVerticesScalar"),
+			NumDirections, Seconds[0] * 1.0e9 / NumRepeats, Seconds[1] * 1.0e9 / NumRepeats));
+	}
+
+	return true;
+}
+
+#endif
@@ -0,0 +1,80 @@
+// Microbenchmark of the engine-independent ring generator, see RadialMeshGenerator.h.
+// Tessellates many bars per resolution and progress and reports nanoseconds per bar and vertices per second.
+//
+//   RadialMeshGeneratorBenchmark [NumBars]
+
+#include "RadialMeshGenerator.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <initializer_list>
+
+using namespace RadialMesh;
+
+namespace
+{
+	/** Keeps the generated geometry observable so the compiler cannot drop the work */
+	volatile float Sink;
+
+	struct FResult
+	{
+		double NanosecondsPerBar;
+		double VerticesPerSecond;
+	};
+
+	FResult Run(int32_t Resolution, float Progress, int32_t NumBars)
+	{
+		FPoint Pairs[MaxPairCount * 2];
+
+		FArcParams Params;
+		Params.RadiusInner = 32.0f;
+		Params.RadiusOuter = 48.0f;
+		Params.SweepFraction = Progress;
+		Params.Resolution = Resolution;
+
+		// Warm the shared unit circle tables before timing
+		GenerateArcPositions(Params, Pairs);
+
+		int64_t NumVertices = 0;
+		float Accumulated = 0.0f;
+
+		const auto Start = std::chrono::steady_clock::now();
+		for (int32_t BarIndex = 0; BarIndex < NumBars; ++BarIndex)
+		{
+			// Every bar sits somewhere else and starts elsewhere, like a screen full of them
+			Params.CenterX = (float)(BarIndex & 63) * 96.0f;
+			Params.CenterY = (float)(BarIndex >> 6) * 96.0f;
+			Params.StartFraction = (float)(BarIndex % 360) / 360.0f;
+
+			const int32_t NumPairs = GenerateArcPositions(Params, Pairs);
+			NumVertices += NumPairs * 2;
+			Accumulated += NumPairs > 0 ? Pairs[NumPairs * 2 - 1].X : 0.0f;
+		}
+		const auto End = std::chrono::steady_clock::now();
+
+		Sink = Accumulated;
+
+		const double Seconds = std::chrono::duration<double>(End - Start).count();
+		return { Seconds * 1.0e9 / NumBars, Seconds > 0.0 ? NumVertices / Seconds : 0.0 };
+	}
+}
+
+int main(int Argc, char** Argv)
+{
+	const int32_t NumBars = Argc > 1 ? std::max(std::atoi(Argv[1]), 1) : 200000;
+
+	std::printf("%10s %10s %14s %18s\n", "Resolution", "Progress", "ns/bar", "vertices/sec");
+	for (const int32_t Resolution : { 16, 64, 256 })
+	{
+		for (const float Progress : { 0.1f, 0.5f, 0.75f, 1.0f })
+		{
+			const FResult Result = Run(Resolution, Progress, NumBars);
+			std::printf("%10d %9.0f%% %14.1f %18.0f\n", Resolution, Progress * 100.0f, Result.NanosecondsPerBar, Result.VerticesPerSecond);
+		}
+	}
+
+	return 0;
+}
@@ -0,0 +1,305 @@
+// Checks of the engine-independent ring generator, see RadialMeshGenerator.h. Exits with a non-zero code on failure.
+
+#include "RadialMeshGenerator.h"
+
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <initializer_list>
+
+using namespace RadialMesh;
+
+namespace
+{
+	constexpr double TwoPi = 6.28318530717958647692;
+
+	/** Tolerance of directions, in radians and unit lengths */
+	constexpr double AngleTolerance = 1.0e-5;
+
+	int32_t NumFailures = 0;
+
+	void Check(bool bCondition, const char* Expression, const char* File, int Line)
+	{
+		if (!bCondition)
+		{
+			++NumFailures;
+			std::fprintf(stderr, "%s:%d: check failed: %s\n", File, Line, Expression);
+		}
+	}
+
+	#define CHECK(Expression) Check((Expression), #Expression, __FILE__, __LINE__)
+
+	/** @return the smallest signed difference between two angles, in radians */
+	double AngleDifference(double A, double B)
+	{
+		const double Difference = std::remainder(A - B, TwoPi);
+		return Difference;
+	}
+
+	double GetAngle(FPoint Point)
+	{
+		return std::atan2((double)Point.Y, (double)Point.X);
+	}
+
+	double GetLength(FPoint Point)
+	{
+		return std::sqrt((double)Point.X * Point.X + (double)Point.Y * Point.Y);
+	}
+
+	bool IsNear(double A, double B, double Tolerance)
+	{
+		return std::abs(A - B) <= Tolerance;
+	}
+
+	void TestUnitCircle()
+	{
+		for (const int32_t Resolution : { MinResolution, 16, MaxResolution })
+		{
+			const FPoint* UnitCircle = GetUnitCircle(Resolution);
+			CHECK(UnitCircle == GetUnitCircle(Resolution));
+			for (int32_t Index = 0; Index <= Resolution; ++Index)
+			{
+				CHECK(IsNear(GetLength(UnitCircle[Index]), 1.0, AngleTolerance));
+				CHECK(IsNear(AngleDifference(GetAngle(UnitCircle[Index]), Index * TwoPi / Resolution), 0.0, AngleTolerance));
+			}
+		}
+
+		// Out of range resolutions are clamped
+		CHECK(GetUnitCircle(0) == GetUnitCircle(MinResolution));
+		CHECK(GetUnitCircle(MaxResolution * 2) == GetUnitCircle(MaxResolution));
+	}
+
+	void TestEmptyAndFullSweeps()
+	{
+		FPoint Directions[MaxPairCount];
+		FPoint Cap[MaxRoundCapPointCount];
+
+		for (const int32_t Resolution : { MinResolution, 16, 100, MaxResolution })
+		{
+			FArcParams Params;
+			Params.Resolution = Resolution;
+			Params.StartFraction = 0.3f;
+			Params.RadiusInner = 10.0f;
+			Params.RadiusOuter = 20.0f;
+
+			// 0%, in both directions, produces nothing
+			for (const float Sweep : { 0.0f, -0.0f })
+			{
+				Params.SweepFraction = Sweep;
+				CHECK(GenerateArcDirections(Params, Directions) == 0);
+				CHECK(GenerateRoundCap(Params, false, Cap) == 0);
+				CHECK(GenerateRoundCap(Params, true, Cap) == 0);
+			}
+
+			// 100%, in both directions, closes the ring on its first direction and has no ends to cap
+			for (const float Sweep : { 1.0f, -1.0f, 1.5f })
+			{
+				Params.SweepFraction = Sweep;
+				const int32_t NumDirections = GenerateArcDirections(Params, Directions);
+				CHECK(NumDirections == Resolution + 1);
+				CHECK(NumDirections <= GetMaxPairCount(Resolution));
+				CHECK(IsNear(Directions[0].X, Directions[NumDirections - 1].X, AngleTolerance));
+				CHECK(IsNear(Directions[0].Y, Directions[NumDirections - 1].Y, AngleTolerance));
+				CHECK(GenerateRoundCap(Params, false, Cap) == 0);
+				CHECK(GenerateRoundCap(Params, true, Cap) == 0);
+			}
+		}
+	}
+
+	void TestPartialSweeps()
+	{
+		FPoint Directions[MaxPairCount];
+
+		for (const int32_t Resolution : { MinResolution, 4, 8, 16, 64, MaxResolution })
+		{
+			for (const float StartFraction : { 0.0f, 0.125f, 0.7f, -0.25f })
+			{
+				for (const float SweepFraction : { 0.001f, 0.25f, 0.3f, 0.5f, 0.999f, -0.001f, -0.3f, -0.75f })
+				{
+					FArcParams Params;
+					Params.Resolution = Resolution;
+					Params.StartFraction = StartFraction;
+					Params.SweepFraction = SweepFraction;
+
+					const int32_t NumDirections = GenerateArcDirections(Params, Directions);
+					CHECK(NumDirections >= 2);
+					CHECK(NumDirections <= GetMaxPairCount(Resolution));
+
+					// Starts on the start angle and ends on the exact end of the sweep, whatever the resolution
+					const double StartAngle = StartFraction * TwoPi;
+					const double EndAngle = (StartFraction + SweepFraction) * TwoPi;
+					CHECK(IsNear(AngleDifference(GetAngle(Directions[0]), StartAngle), 0.0, AngleTolerance));
+					CHECK(IsNear(AngleDifference(GetAngle(Directions[NumDirections - 1]), EndAngle), 0.0, AngleTolerance));
+
+					// Every direction is a unit vector, and they advance monotonically in the direction of the sweep
+					const double Mirror = SweepFraction < 0.0f ? -1.0 : 1.0;
+					for (int32_t Index = 0; Index < NumDirections; ++Index)
+					{
+						CHECK(IsNear(GetLength(Directions[Index]), 1.0, AngleTolerance));
+						if (Index > 0)
+						{
+							const double Step = AngleDifference(GetAngle(Directions[Index]), GetAngle(Directions[Index - 1])) * Mirror;
+							CHECK(Step > 0.0 && Step <= TwoPi / Resolution + AngleTolerance);
+						}
+					}
+				}
+			}
+		}
+	}
+
+	void TestArcPositions()
+	{
+		FPoint Directions[MaxPairCount];
+		FPoint Pairs[MaxPairCount * 2];
+
+		FArcParams Params;
+		Params.CenterX = 50.0f;
+		Params.CenterY = -20.0f;
+		Params.RadiusInner = 32.0f;
+		Params.RadiusOuter = 48.0f;
+		Params.StartFraction = 0.25f;
+		Params.SweepFraction = -0.6f;
+		Params.Resolution = 24;
+
+		const int32_t NumDirections = GenerateArcDirections(Params, Directions);
+		const int32_t NumPairs = GenerateArcPositions(Params, Pairs);
+		CHECK(NumPairs == NumDirections);
+
+		for (int32_t PairIndex = 0; PairIndex < NumPairs; ++PairIndex)
+		{
+			const FPoint& Inner = Pairs[PairIndex * 2 + 0];
+			const FPoint& Outer = Pairs[PairIndex * 2 + 1];
+			CHECK(IsNear(Inner.X, Params.CenterX + Directions[PairIndex].X * Params.RadiusInner, 1.0e-3));
+			CHECK(IsNear(Inner.Y, Params.CenterY + Directions[PairIndex].Y * Params.RadiusInner, 1.0e-3));
+			CHECK(IsNear(Outer.X, Params.CenterX + Directions[PairIndex].X * Params.RadiusOuter, 1.0e-3));
+			CHECK(IsNear(Outer.Y, Params.CenterY + Directions[PairIndex].Y * Params.RadiusOuter, 1.0e-3));
+		}
+
+		Params.SweepFraction = 0.0f;
+		CHECK(GenerateArcPositions(Params, Pairs) == 0);
+	}
+
+	void TestRoundCaps()
+	{
+		FPoint Cap[MaxRoundCapPointCount];
+
+		for (const int32_t Resolution : { MinResolution, 16, MaxResolution })
+		{
+			for (const float SweepFraction : { 0.3f, -0.3f })
+			{
+				FArcParams Params;
+				Params.CenterX = 10.0f;
+				Params.CenterY = 20.0f;
+				Params.RadiusInner = 30.0f;
+				Params.RadiusOuter = 50.0f;
+				Params.StartFraction = 0.1f;
+				Params.SweepFraction = SweepFraction;
+				Params.Resolution = Resolution;
+
+				const double HalfWidth = (Params.RadiusOuter - Params.RadiusInner) * 0.5;
+				const double MidRadius = Params.RadiusInner + HalfWidth;
+				const double Mirror = SweepFraction < 0.0f ? -1.0 : 1.0;
+
+				for (const bool bEndCap : { false, true })
+				{
+					const int32_t NumPoints = GenerateRoundCap(Params, bEndCap, Cap);
+					CHECK(NumPoints == GetRoundCapPointCount(Resolution));
+					CHECK(NumPoints <= MaxRoundCapPointCount);
+
+					// The centre sits half way across the ring on the start or the end of the sweep
+					const double CapAngle = (Params.StartFraction + (bEndCap ? SweepFraction : 0.0f)) * TwoPi;
+					const FPoint Centre = { Cap[0].X - Params.CenterX, Cap[0].Y - Params.CenterY };
+					CHECK(IsNear(GetLength(Centre), MidRadius, 1.0e-3));
+					CHECK(IsNear(AngleDifference(GetAngle(Centre), CapAngle), 0.0, AngleTolerance));
+
+					// The rim is a half circle from the outer edge to the inner edge, bulging out of the arc
+					CHECK(IsNear(GetLength({ Cap[1].X - Params.CenterX, Cap[1].Y - Params.CenterY }), Params.RadiusOuter, 1.0e-3));
+					CHECK(IsNear(GetLength({ Cap[NumPoints - 1].X - Params.CenterX, Cap[NumPoints - 1].Y - Params.CenterY }), Params.RadiusInner, 1.0e-3));
+
+					const double Bulge = bEndCap ? Mirror : -Mirror;
+					for (int32_t PointIndex = 1; PointIndex < NumPoints; ++PointIndex)
+					{
+						const FPoint Rim = { Cap[PointIndex].X - Params.CenterX, Cap[PointIndex].Y - Params.CenterY };
+						CHECK(IsNear(GetLength({ Cap[PointIndex].X - Cap[0].X, Cap[PointIndex].Y - Cap[0].Y }), HalfWidth, 1.0e-3));
+						CHECK(AngleDifference(GetAngle(Rim), CapAngle) * Bulge >= -AngleTolerance);
+					}
+				}
+			}
+		}
+	}
+
+	template<typename IndexType>
+	void TestArcIndexTable()
+	{
+		const IndexType* Table = GetArcIndexTable<IndexType>();
+		CHECK(Table == GetArcIndexTable<IndexType>());
+
+		// Any arc's indices are a prefix of the shared table
+		IndexType Indices[MaxIndexCount];
+		for (const int32_t NumPairs : { 2, 3, 17, MaxPairCount })
+		{
+			GenerateArcIndices<IndexType>(NumPairs, 0, Indices);
+			const int32_t NumIndices = (NumPairs - 1) * 6;
+			bool bPrefix = true;
+			for (int32_t Index = 0; Index < NumIndices; ++Index)
+			{
+				bPrefix &= Indices[Index] == Table[Index];
+			}
+			CHECK(bPrefix);
+		}
+
+		// (inner, outer, next inner), (outer, next outer, next inner), never past the last pair
+		const IndexType FirstQuad[6] = { 0, 1, 2, 1, 3, 2 };
+		for (int32_t Index = 0; Index < 6; ++Index)
+		{
+			CHECK(Table[Index] == FirstQuad[Index]);
+		}
+
+		IndexType LargestIndex = 0;
+		for (int32_t Index = 0; Index < MaxIndexCount; ++Index)
+		{
+			LargestIndex = Table[Index] > LargestIndex ? Table[Index] : LargestIndex;
+		}
+		CHECK(LargestIndex == MaxPairCount * 2 - 1);
+
+		// An offset base vertex shifts every index
+		GenerateArcIndices<IndexType>(3, 10, Indices);
+		for (int32_t Index = 0; Index < 12; ++Index)
+		{
+			CHECK(Indices[Index] == Table[Index] + 10);
+		}
+	}
+
+	void TestRoundCapIndices()
+	{
+		uint16_t Indices[(MaxRoundCapPointCount - 2) * 3];
+		GenerateRoundCapIndices<uint16_t>(5, 7, Indices);
+
+		const uint16_t Expected[9] = { 7, 8, 9, 7, 9, 10, 7, 10, 11 };
+		for (int32_t Index = 0; Index < 9; ++Index)
+		{
+			CHECK(Indices[Index] == Expected[Index]);
+		}
+	}
+}
+
+int main()
+{
+	TestUnitCircle();
+	TestEmptyAndFullSweeps();
+	TestPartialSweeps();
+	TestArcPositions();
+	TestRoundCaps();
+	TestArcIndexTable<uint16_t>();
+	TestArcIndexTable<uint32_t>();
+	TestRoundCapIndices();
+
+	if (NumFailures > 0)
+	{
+		std::fprintf(stderr, "RadialMeshGenerator: %d checks failed\n", NumFailures);
+		return 1;
+	}
+
+	std::printf("RadialMeshGenerator: all checks passed\n");
+	return 0;
+}